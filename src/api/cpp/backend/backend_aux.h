@@ -33,6 +33,9 @@ class nixlBackendOptionalArgs {
         // During postXfer, user might ask for a notification if supported
         nixl_blob_t notifMsg;
         bool        hasNotif = false;
+
+        // Priority class of the transfer, backends can use it as a hint
+        nixl_xfer_prio_t priority = NIXL_PRIO_NORMAL;
 };
 
 typedef nixlBackendOptionalArgs nixl_opt_b_args_t;
@@ -51,6 +54,9 @@ class nixlBackendInitParams {
 
         bool              enableProgTh;
         nixlTime::us_t    pthrDelay;
+
+        // Small id given by the agent, unique among its engines
+        unsigned int      backendId = 0;
 };
 
 // Pure virtual class to have a common pointer type
@@ -117,4 +123,8 @@ class nixlMetaDesc : public nixlBasicDesc {
 
 typedef nixlDescList<nixlMetaDesc> nixl_meta_dlist_t;
 
+// Non-owning view passed to the backends for transfers, so the agent does not
+// need to copy already prepared descriptors. A nixl_meta_dlist_t converts to it.
+typedef nixlDescListView<nixlMetaDesc> nixl_meta_dview_t;
+
 #endif
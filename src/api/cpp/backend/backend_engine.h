@@ -28,6 +28,7 @@ class nixlBackendEngine {
         // Members that cannot be modified by a child backend and parent bookkeep
         nixl_backend_t   backendType;
         nixl_b_params_t* customParams;
+        unsigned int     backendId;
 
     protected:
         // Members that can be accessed by the child (localAgent cannot be modified)
@@ -57,6 +58,7 @@ class nixlBackendEngine {
             : localAgent(init_params->localAgent) {
 
             this->backendType  = init_params->type;
+            this->backendId    = init_params->backendId;
             this->initErr      = false;
             this->customParams = new nixl_b_params_t(*(init_params->customParams));
         }
@@ -67,6 +69,7 @@ class nixlBackendEngine {
 
         bool getInitErr() { return initErr; }
         nixl_backend_t getType () const { return backendType; }
+        unsigned int getId () const { return backendId; }
         nixl_b_params_t getCustomParams () const { return *customParams; }
 
         // The support function determine which methods are necessary by the child backend, and
@@ -87,6 +90,17 @@ class nixlBackendEngine {
 
         virtual nixl_mem_list_t getSupportedMems () const = 0;
 
+        // Determines if registerMem and deregisterMem can be called from several
+        // threads at once, while the agent thread keeps using the engine for
+        // other calls. registerMemAsync registers in the background only with
+        // such backends. Not required by default.
+        virtual bool supportsParallelReg () const { return false; }
+
+        // Adds backend specific counters, such as progress loop iterations, to
+        // the agent telemetry. It can be called from the exporter thread while
+        // the agent thread uses the engine, so counters should be atomics.
+        virtual void getCounters (std::map<std::string, uint64_t> &counters) const { }
+
 
         // *** Pure virtual methods that need to be implemented by any backend *** //
 
@@ -107,8 +121,8 @@ class nixlBackendEngine {
 
         // Preparing a request, which populates the async handle as desired
         virtual nixl_status_t prepXfer (const nixl_xfer_op_t &operation,
-                                        const nixl_meta_dlist_t &local,
-                                        const nixl_meta_dlist_t &remote,
+                                        const nixl_meta_dview_t &local,
+                                        const nixl_meta_dview_t &remote,
                                         const std::string &remote_agent,
                                         nixlBackendReqH* &handle,
                                         const nixl_opt_b_args_t* opt_args=nullptr
@@ -116,8 +130,8 @@ class nixlBackendEngine {
 
         // Posting a request, which completes the async handle creation and posts it
         virtual nixl_status_t postXfer (const nixl_xfer_op_t &operation,
-                                        const nixl_meta_dlist_t &local,
-                                        const nixl_meta_dlist_t &remote,
+                                        const nixl_meta_dview_t &local,
+                                        const nixl_meta_dview_t &remote,
                                         const std::string &remote_agent,
                                         nixlBackendReqH* &handle,
                                         const nixl_opt_b_args_t* opt_args=nullptr
@@ -124,6 +124,97 @@ class nixlAgent {
         deregisterMem (const nixl_reg_dlist_t &descs,
                        const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Memory release hook, to be called before freeing memory when the
+         *         registration cache is enabled (see nixlAgentConfig). Cached idle
+         *         registrations overlapping the descriptors are deregistered, so
+         *         a later allocation at the same address is registered again.
+         *         There is no automatic hook on free or munmap: the caller must
+         *         call it before releasing the memory, or else stale pinned
+         *         registrations stay in the cache and may be matched by a new
+         *         allocation at the same address.
+         *
+         * @param  descs         Descriptor list of the buffers being freed
+         * @return nixl_status_t NIXL_ERR_NOT_ALLOWED if some of the memory is still
+         *                       registered, which is left untouched
+         */
+        nixl_status_t
+        releasedMem (const nixl_xfer_dlist_t &descs);
+
+        /**
+         * @brief  Start registering a memory list, pre-faulting it in the
+         *         background. DRAM is pre-faulted in parallel chunks, on up to
+         *         workerThreads threads (see nixlAgentConfig), which is most of
+         *         the cost of pinning large buffers. Only backends whose
+         *         registration is thread safe, such as GDS, also register the
+         *         descriptors in the background. The others, such as UCX, are
+         *         registered by the getRegStatus call that finds the background
+         *         work done, as are all backends when the registration cache or
+         *         coalesceRegs is enabled, so that call takes about as long as
+         *         registerMem of pre-faulted memory. The memory is usable once
+         *         getRegStatus returns NIXL_SUCCESS.
+         *
+         * @param  descs          Descriptor list of the buffers to be registered
+         * @param  req_hndl [out] Registration request handle
+         * @param  extra_params   Optional extra parameters used in registering memory
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        registerMemAsync (const nixl_reg_dlist_t &descs,
+                          nixlRegReqH* &req_hndl,
+                          const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Check the status of a registration request. When the background
+         *         work is done, the first call adds the memory to the agent and
+         *         returns the same result as registerMem would.
+         *
+         * @param  req_hndl      Registration request handle
+         * @return nixl_status_t NIXL_IN_PROG or the result of the registration
+         */
+        nixl_status_t
+        getRegStatus (nixlRegReqH* req_hndl);
+
+        /**
+         * @brief  Release a registration request. It waits for the background
+         *         work, and if the result was not yet collected by getRegStatus,
+         *         the registration is undone.
+         *
+         * @param  req_hndl      Registration request handle to be released
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        releaseRegReq (nixlRegReqH* req_hndl);
+
+        /**
+         * @brief  Allocate a buffer from agent managed arenas. An arena is mapped
+         *         with huge pages when available and registered once with the
+         *         backends, and buffers are sub-allocated from it, so they can be
+         *         used in transfers without registerMem. Arenas are kept until
+         *         the agent is destroyed. Only DRAM_SEG is supported.
+         *
+         * @param  size          Size of the buffer in bytes
+         * @param  mem_type      Memory type of the buffer
+         * @param  desc [out]    Descriptor of the allocated buffer
+         * @param  extra_params  Optional backends to register new arenas with,
+         *                       and NUMA node to bind them to
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        allocMem (const size_t &size,
+                  const nixl_mem_t &mem_type,
+                  nixlBlobDesc &desc,
+                  const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Return a buffer from allocMem to its arena.
+         *
+         * @param  desc          Descriptor given by allocMem
+         * @return nixl_status_t NIXL_ERR_NOT_FOUND if not allocated by allocMem
+         */
+        nixl_status_t
+        freeMem (const nixlBlobDesc &desc);
+
         /**
          * @brief  Make connection proactively, instead of at the time of the first transfer
          *         towards the target agent. If a list of backends hints is provided
@@ -221,6 +312,92 @@ class nixlAgent {
                        nixlXferReqH* &req_hndl,
                        const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Make a broadcast request `req_hndl`, writing the same local descriptors
+         *         to each of the remote prepared descriptor list handles, e.g. the same
+         *         KV prefix to several replicas. The local side is prepared once and shared
+         *         by all the destinations, whose writes are posted back to back. The request
+         *         completes once all the destinations are done, and its notification is
+         *         sent to each of them as soon as its own write completed.
+         *
+         * @param  local_side       Local prepared descriptor list handle
+         * @param  local_indices    Indices list to the local prepared descriptor list handle
+         * @param  remote_sides     Remote prepared descriptor list handles, one per destination
+         * @param  remote_indices   Indices list to each of the remote prepared handles
+         * @param  req_handle [out] Transfer request handle output
+         * @param  extra_params     Optional additional parameters, same as makeXferReq
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        makeBcastXferReq (const nixlDlistH* local_side,
+                          const std::vector<int> &local_indices,
+                          const std::vector<const nixlDlistH*> &remote_sides,
+                          const std::vector<int> &remote_indices,
+                          nixlXferReqH* &req_hndl,
+                          const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  A combined API, to create a broadcast request from a local descriptor
+         *         list and a descriptor list for each remote agent, same as preparing them
+         *         and calling makeBcastXferReq with all the indices.
+         *
+         * @param  local_descs    Local descriptor list
+         * @param  remote_descs   Remote descriptor lists, one per destination
+         * @param  remote_agents  Remote agent names, one per destination
+         * @param  req_hndl [out] Transfer request handle output
+         * @param  extra_params   Optional extra parameters, same as createXferReq
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        createBcastXferReq (const nixl_xfer_dlist_t &local_descs,
+                            const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                            const std::vector<std::string> &remote_agents,
+                            nixlXferReqH* &req_hndl,
+                            const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Make a gather request `req_hndl`, reading from several remote prepared
+         *         descriptor list handles, e.g. KV blocks spread across several workers,
+         *         into the local prepared descriptor list handle. The reads from all the
+         *         sources are posted back to back, so they are in flight together, and the
+         *         request has a single status, completing once all of them are done. Its
+         *         notification is sent to each source as soon as its own reads completed.
+         *
+         * @param  local_side       Local prepared descriptor list handle
+         * @param  local_indices    Indices list to the local prepared handle, per source
+         * @param  remote_sides     Remote prepared descriptor list handles, one per source
+         * @param  remote_indices   Indices list to each of the remote prepared handles
+         * @param  req_handle [out] Transfer request handle output
+         * @param  extra_params     Optional additional parameters, same as makeXferReq
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        makeGatherXferReq (const nixlDlistH* local_side,
+                           const std::vector<std::vector<int>> &local_indices,
+                           const std::vector<const nixlDlistH*> &remote_sides,
+                           const std::vector<std::vector<int>> &remote_indices,
+                           nixlXferReqH* &req_hndl,
+                           const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  A combined API, to create a gather request from a local and a remote
+         *         descriptor list per source agent, same as preparing the local lists as
+         *         one and each remote list, and calling makeGatherXferReq.
+         *
+         * @param  local_descs    Local descriptor lists, one per source
+         * @param  remote_descs   Remote descriptor lists, one per source
+         * @param  remote_agents  Remote agent names, one per source
+         * @param  req_hndl [out] Transfer request handle output
+         * @param  extra_params   Optional extra parameters, same as createXferReq
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        createGatherXferReq (const std::vector<nixl_xfer_dlist_t> &local_descs,
+                             const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                             const std::vector<std::string> &remote_agents,
+                             nixlXferReqH* &req_hndl,
+                             const nixl_opt_args_t* extra_params = nullptr) const;
+
         /*** Operations on prepared Transfer Request ***/
 
         /**
@@ -229,11 +406,14 @@ class nixlAgent {
          *         In case of small transfers that are completed within the call, return value
          *         will be NIXL_SUCCESS. Otherwise, the output status will be NIXL_IN_PROG until
          *         completion. Notification  message  can be preovided through the extra_params,
-         *         and can be updated per re-post.
+         *         and can be updated per re-post. The post can also be chained after other
+         *         transfer requests through the extra_params, e.g., a write to a remote agent
+         *         after a read from storage, which the agent then starts by itself.
          *
          * @param  req_hndl      Transfer request handle obtained from makeXferReq/createXferReq
          * @param  extra_params  Optional extra parameters used in posting a transfer request
-         * @return nixl_status_t NIXL_IN_PROG or error code if call was not successful
+         * @return nixl_status_t NIXL_IN_PROG or error code if call was not successful,
+         *                       NIXL_ERR_OVER_LIMIT if rejected by transfer limits
          */
         nixl_status_t
         postXferReq (nixlXferReqH* req_hndl,
@@ -248,6 +428,60 @@ class nixlAgent {
         nixl_status_t
         getXferStatus (nixlXferReqH* req_hndl);
 
+        /**
+         * @brief  Check the status of transfer request `req_hndl` as getXferStatus, and
+         *         report which of its segments completed (see nixlAgentOptionalArgs), so
+         *         a consumer can start on them while the others are still in progress.
+         *
+         * @param  req_hndl       Transfer request handle after postXferReq
+         * @param  progress [out] Completed bytes and segments of the current post
+         * @return nixl_status_t  Same as getXferStatus
+         */
+        nixl_status_t
+        getXferProgress (nixlXferReqH* req_hndl,
+                         nixl_xfer_progress_t &progress);
+
+        /**
+         * @brief  Cancel transfer request `req_hndl` if it is in progress. It does not
+         *         fail if the backend cannot abort the transfer right away: the backend
+         *         request is then detached and aborted later by the agent, so the memory
+         *         of the transfer should stay valid. A canceled request can only be
+         *         released, and its status is NIXL_ERR_NOT_POSTED.
+         *
+         * @param  req_hndl      Transfer request handle to be canceled
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        cancelXferReq (nixlXferReqH* req_hndl);
+
+        /**
+         * @brief  Set the limits of the transfers posted to `remote_agent`, replacing
+         *         nixlAgentConfig::peerLimits for it. Transfers in progress are kept,
+         *         and count towards the new limits. The remote does not need to be
+         *         loaded yet. Posts over the limits are held back in order, and started
+         *         from getXferStatus calls, or rejected with NIXL_ERR_OVER_LIMIT.
+         *
+         * @param  remote_agent  Remote agent name
+         * @param  limits        Limits of the transfers to it, all 0 for no limits
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        setPeerLimits (const std::string &remote_agent,
+                       const nixl_xfer_limits_t &limits);
+
+        /**
+         * @brief  Set the limits of the transfers posted through `backend`, to all the
+         *         remote agents, same as setPeerLimits. The parts of a striped transfer
+         *         count towards the limits of their own backend.
+         *
+         * @param  backend       Backend handle of the agent
+         * @param  limits        Limits of the transfers through it, all 0 for no limits
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        setBackendLimits (const nixlBackendH* backend,
+                          const nixl_xfer_limits_t &limits);
+
         /**
          * @brief  Query the backend associated with `req_hndl`. E.g., if for genNotif
          *         the same backend as a transfer is desired.
@@ -271,7 +505,66 @@ class nixlAgent {
         releaseXferReq (nixlXferReqH* req_hndl);
 
         /**
-         * @brief  Release the prepared descriptor list handle `dlist_hndl`
+         * @brief  Create a stream over the segmented transfer request `req_hndl`, to
+         *         post its segments one at a time as chunks, e.g. each layer of a model
+         *         as soon as it is computed, reusing the prepared request. Once all the
+         *         chunks completed, the next postXferChunk starts over from the first.
+         *         The request is not posted or released by itself while it has a stream.
+         *
+         * @param  req_hndl      Segmented transfer request, not in progress
+         * @param  stream [out]  Stream handle for posting the chunks
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        createXferStream (nixlXferReqH* req_hndl,
+                          nixlXferStreamH* &stream) const;
+
+        /**
+         * @brief  Post the next chunk of `stream`. The chunk notifications reach the
+         *         target in chunk order, each once its chunk and the ones before it
+         *         completed. A chunk posted while the previous ones are done carries
+         *         its notification in the same backend post, otherwise the agent sends
+         *         it from getXferStreamStatus when the chunks before it complete.
+         *         Chunks are posted right away, the limits and priority holding of
+         *         the agent do not apply to them.
+         *
+         * @param  stream        Stream handle obtained from createXferStream
+         * @param  notif_msg     Notification of the chunk, none if empty
+         * @return nixl_status_t NIXL_IN_PROG or NIXL_SUCCESS if the stream completed,
+         *                       NIXL_ERR_REPOST_ACTIVE if all the chunks were posted
+         *                       and are not completed yet, or error code
+         */
+        nixl_status_t
+        postXferChunk (nixlXferStreamH* stream,
+                       const nixl_blob_t &notif_msg = "") const;
+
+        /**
+         * @brief  Check the chunks posted on `stream` in order, and send the pending
+         *         notifications of the completed ones.
+         *
+         * @param  stream        Stream handle obtained from createXferStream
+         * @return nixl_status_t NIXL_SUCCESS once all the chunks completed, NIXL_IN_PROG
+         *                       while some are in progress or not yet posted, or the
+         *                       error of a failed chunk
+         */
+        nixl_status_t
+        getXferStreamStatus (nixlXferStreamH* stream) const;
+
+        /**
+         * @brief  Release `stream`, aborting its chunks in progress, or return an error
+         *         if they cannot be aborted. Its transfer request can then be posted or
+         *         released again.
+         *
+         * @param  stream        Stream handle to be released
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        releaseXferStream (nixlXferStreamH* stream) const;
+
+        /**
+         * @brief  Release the prepared descriptor list handle `dlist_hndl`. Transfer
+         *         requests already made from it remain valid, as it is kept alive till
+         *         they are released.
          *
          * @param  dlist_hndl    Prepared descriptor list handle to be released
          * @return nixl_status_t Error code if call was not successful
@@ -279,6 +572,40 @@ class nixlAgent {
         nixl_status_t
         releasedDlistH (nixlDlistH* dlist_hndl) const;
 
+        /**
+         * @brief  Take a snapshot of the transfer telemetry, per remote agent and per
+         *         backend (see nixlAgentConfig). It can be called from any thread.
+         *
+         * @param  stats         Output stats, replacing its previous content
+         * @return nixl_status_t NIXL_ERR_NOT_SUPPORTED if telemetry is not enabled
+         */
+        nixl_status_t
+        getStats (nixl_agent_stats_t &stats) const;
+
+        /**
+         * @brief  Serialize a snapshot of the telemetry, e.g., to serve it from a user
+         *         endpoint. It can be called from any thread. The output is what the
+         *         exporter of nixlAgentConfig::statsExportPath writes.
+         *
+         * @param  out           Output text, replacing its previous content
+         * @param  format        Prometheus text exposition format or JSON
+         * @return nixl_status_t NIXL_ERR_NOT_SUPPORTED if telemetry is not enabled
+         */
+        nixl_status_t
+        exportStats (std::string &out,
+                     const nixl_stats_fmt_t &format = NIXL_STATS_PROMETHEUS) const;
+
+        /**
+         * @brief  Write the recorded spans of all the threads of the process as a Chrome
+         *         trace JSON file, to be opened in chrome://tracing or Perfetto. Tracing
+         *         is enabled with nixlAgentConfig::enableTracing.
+         *
+         * @param  path          Output file path
+         * @return nixl_status_t NIXL_ERR_BACKEND if the file could not be written
+         */
+        nixl_status_t
+        dumpTrace (const std::string &path) const;
+
 
         /*** Notification Handling ***/
 
@@ -287,6 +614,8 @@ class nixlAgent {
          *         from agent name to a list of notification received from that agent. Elements
          *         are released within the agent after this call. Optionally, a list of backends
          *         can be mentioned in extra_params to only get those backends notifications.
+         *         With packXfers, the packed writes received are scattered and acknowledged
+         *         to their initiator from this call, and only their user messages are added.
          *
          * @param  notif_map     Input notifications list
          * @param  extra_params  Optional extra parameters used in getting notifications
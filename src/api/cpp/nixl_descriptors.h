@@ -333,6 +333,24 @@ class nixlDescList {
          */
         nixl_status_t populate(const nixlDescList<nixlBasicDesc> &query,
                                nixlDescList<T> &resp) const;
+        /**
+         * @brief Populate only the [start, end) range of `query` into the same
+         *        range of `resp`, so a very large query can be split into chunks
+         *        that are populated concurrently. `resp` should already have the
+         *        type, sortedness and size of `query`, for instance created with
+         *        init_size, and it is not cleared if population fails.
+         *
+         * @param  query      nixlDescList object, made from nixlBasicDesc, as input query
+         * @param  resp [out] populated response, only the given range is written
+         * @param  start      Index of the first descriptor of the range
+         * @param  end        Index after the last descriptor of the range
+         *
+         * @return nixl_status_t Error code if population was not successful
+         */
+        nixl_status_t populate(const nixlDescList<nixlBasicDesc> &query,
+                               nixlDescList<T> &resp,
+                               const int &start,
+                               const int &end) const;
         /**
          * @brief Convert a nixlDescList with metadata by trimming it to a
          *        nixlDescList of nixlBasicDesc elements
@@ -363,6 +381,107 @@ class nixlDescList {
          */
         void print() const;
 };
+
+/**
+ * @class nixlDescListView
+ * @brief A non-owning read-only view over a nixlDescList, either covering a
+ *        contiguous range of its descriptors or selecting them through an index
+ *        map. No descriptors are copied. The viewed list and the index map
+ *        should outlive the view, and the list should not be resized meanwhile.
+ */
+template<class T>
+class nixlDescListView {
+    private:
+        /** @var NIXL memory type */
+        nixl_mem_t type;
+        /** @var Flag for if the viewed descriptors are sorted */
+        bool       sorted;
+        /** @var Pointer to the first descriptor of the viewed list or range */
+        const T*   base;
+        /** @var Optional index map into base, nullptr for contiguous views */
+        const int* indices;
+        /** @var Count of descriptors in the view */
+        int        count;
+
+    public:
+        /**
+         * @brief Constructor for an empty nixlDescListView
+         *
+         * @param type         NIXL memory type of the view
+         */
+        nixlDescListView(const nixl_mem_t &type = DRAM_SEG);
+        /**
+         * @brief Constructor for a view over a whole nixlDescList. Intentionally
+         *        not explicit, so a list can be passed where a view is expected.
+         *
+         * @param d_list       nixlDescList object to be viewed
+         */
+        nixlDescListView(const nixlDescList<T> &d_list);
+        /**
+         * @brief Constructor for a view over a contiguous range of a nixlDescList.
+         *        Can throw std::out_of_range exception.
+         *
+         * @param d_list       nixlDescList object to be viewed
+         * @param start        Index of the first descriptor in the view
+         * @param count        Number of descriptors in the view
+         */
+        nixlDescListView(const nixlDescList<T> &d_list,
+                         const int &start, const int &count);
+        /**
+         * @brief Constructor for a view selecting descriptors of a nixlDescList
+         *        through an index map. Indices are not checked, and should be
+         *        already verified to be within the range of the list.
+         *
+         * @param d_list       nixlDescList object to be viewed
+         * @param indices      Index map into d_list, with at least count elements
+         * @param count        Number of descriptors in the view
+         */
+        nixlDescListView(const nixlDescList<T> &d_list,
+                         const int* indices, const int &count);
+        /**
+         * @brief      Get NIXL memory type for this view
+         */
+        inline nixl_mem_t getType() const { return type; }
+        /**
+         * @brief get sorted flag
+         */
+        inline bool isSorted() const { return sorted; }
+        /**
+         * @brief       Get count of descriptors
+         */
+        inline int descCount() const { return count; }
+        /**
+         * @brief Check if the view is empty or not
+         */
+        inline bool isEmpty() const { return (count==0); }
+        /**
+         * @brief Check if the view covers a contiguous range without index map
+         */
+        inline bool isContiguous() const { return (indices==nullptr); }
+        /**
+         * @brief Operator [] overloading, get descriptor at [index].
+         *        No bounds checking is done, as it is meant for the datapath.
+         */
+        inline const T& operator[](unsigned int index) const
+            { return indices ? base[indices[index]] : base[index]; }
+        /**
+         * @brief Get a view over a contiguous range of the descriptors of this view,
+         *        sharing its list and index map. No bounds checking is done.
+         *
+         * @param start        Index of the first descriptor in this view
+         * @param count        Number of descriptors in the new view
+         */
+        inline nixlDescListView<T> subView(const int &start, const int &count) const {
+            nixlDescListView<T> view(*this);
+            if (indices)
+                view.indices = indices + start;
+            else if (base)
+                view.base    = base + start;
+            view.count = count;
+            return view;
+        }
+};
+
 /**
  * @brief A typedef for a nixlDescList<nixlBasicDesc>
  *        used for creating transfer descriptor lists
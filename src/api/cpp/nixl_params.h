@@ -43,6 +43,172 @@ class nixlAgentConfig {
          */
         uint64_t pthrDelay;
 
+        /**
+         * @var Max number of entries in the createXferReq cache (0 disables it)
+         *      When enabled, repeated createXferReq calls with the same descriptor
+         *      lists, remote agent and backend hints reuse the prepared descriptors
+         *      instead of populating them again. The cache is invalidated whenever
+         *      local or remote metadata changes.
+         */
+        size_t   xferCacheSize = 0;
+
+        /**
+         * @var Number of threads used to prepare very large descriptor lists
+         *      (0 or 1 keeps it serial). When set, prepXferDlist splits large
+         *      queries into chunks and populates the chunks of all the backends
+         *      concurrently. Small lists are still populated serially. It is
+         *      also the number of threads (at least 1) running the background
+         *      work of all the registerMemAsync calls.
+         */
+        size_t   workerThreads = 0;
+
+        /**
+         * @var Byte budget of the registration cache (0 disables it)
+         *      When enabled, registering DRAM or VRAM already covered by a
+         *      registration reuses its backend metadata, and deregistration is
+         *      lazy: the last deregistration of a region keeps it registered in
+         *      the backend until the idle ones exceed the budget, least recently
+         *      used first. Memory being freed should be reported with releasedMem.
+         */
+        size_t   regCacheSize = 0;
+
+        /**
+         * @var Coalesce overlapping or adjacent DRAM and VRAM registrations
+         *      When enabled, each backend keeps disjoint registered regions: a
+         *      registration covered by a region reuses it, and one overlapping
+         *      or adjacent to regions is registered as their union instead.
+         *      This gives fewer backend handles and smaller metadata. A region
+         *      is deregistered when all the registrations within it are.
+         */
+        bool     coalesceRegs = false;
+
+        /**
+         * @var Minimum size of the arenas allocMem maps and registers (in bytes)
+         *      Sizes are rounded up to a power of two and at least 2MB. With 0,
+         *      each arena is just large enough for the allocation that maps it.
+         */
+        size_t   allocArenaSize = 0;
+
+        /**
+         * @var Stripe each createXferReq transfer across all the backends
+         *      that can do it, which are the common backends of the two sides,
+         *      or the backends given in the optional arguments. The bytes are
+         *      balanced between them, and descriptors are only split at
+         *      multiples of stripeChunkSize from their start (0 keeps each
+         *      descriptor whole). The parts are tracked under one handle, and
+         *      its notification is sent once all of them have completed.
+         *      Striped requests are not kept in the createXferReq cache.
+         */
+        bool     stripeXfers     = false;
+        size_t   stripeChunkSize = 0;
+
+        /**
+         * @var In-flight bytes over which low priority posts are held (0 disables it)
+         *      When enabled, the agent tracks the bytes of its transfers in progress.
+         *      A low priority post is held back while a high priority transfer is
+         *      in progress, or while it would take the in-flight bytes over this
+         *      limit, unless nothing else is in flight. Held posts are started in
+         *      order from getXferStatus calls, and read as in progress meanwhile.
+         */
+        size_t   prioInflightBytes = 0;
+
+        /**
+         * @var Default limits of the transfers posted to each remote agent
+         *      Posts over the rate or in-flight limits are held back, or rejected
+         *      with NIXL_ERR_OVER_LIMIT if reject is set, same as the limits given
+         *      per remote agent or per backend with setPeerLimits/setBackendLimits.
+         *      Held posts are started in order from getXferStatus calls, and read
+         *      as in progress meanwhile.
+         */
+        nixl_xfer_limits_t peerLimits;
+
+        /**
+         * @var Coalesce small posts to the same peer (coalesceMaxReqs 0 or 1 disables it)
+         *      When enabled, posts of at most coalesceMaxBytes to the same remote agent,
+         *      over the same backend and in the same direction, are gathered and given
+         *      to the backend as one transfer, with a single flush. It is posted once
+         *      coalesceMaxReqs posts were gathered, or coalesceWindowUs after the first
+         *      one. The agent has no progress thread, so the window is only checked
+         *      within postXferReq, getXferStatus and getNotifs calls, and a batch is left
+         *      open as long as none of them is made. Each request keeps its own status.
+         *      Notifications are not sent with the data: once the merged transfer
+         *      completed, the agent sends one notification per request in order of post,
+         *      so they can arrive after those of later posts that were not coalesced.
+         *      While the merged transfer is in progress, releaseXferReq on one of its
+         *      requests returns NIXL_ERR_REPOST_ACTIVE if it has other requests, and the
+         *      request stays valid; once completed, each request is released on its own.
+         *      High priority posts, posts with a timeout and posts of several parts are
+         *      not coalesced.
+         */
+        size_t   coalesceMaxReqs  = 0;
+        size_t   coalesceMaxBytes = 65536;
+        uint64_t coalesceWindowUs = 20;
+
+        /**
+         * @var Copy loopback DRAM transfers within the process
+         *      When enabled, transfers to the agent itself with DRAM on both sides
+         *      are copied by the agent instead of going through their backend.
+         *      Transfers below localCopyAsyncBytes complete within postXferReq,
+         *      larger ones are split across localCopyThreads worker threads that
+         *      use non-temporal stores. Workers are capped to the cores but one, and
+         *      without any (0 threads or a single core) all copies are synchronous.
+         *      Their notifications are queued locally for getNotifs.
+         */
+        bool     localCopy           = false;
+        size_t   localCopyThreads    = 4;
+        size_t   localCopyAsyncBytes = 1048576;
+
+        /**
+         * @var Pack writes of many small DRAM descriptors through staging buffers
+         *      When enabled, a write given pack staging buffers in its optional
+         *      arguments is gathered into the local one and sent as one backend
+         *      transfer if its descriptors are on average at most packMaxDescSize
+         *      bytes, and sent directly otherwise, as the copies of larger ones
+         *      cost more than the backend operations they save. Writes are only
+         *      packed to agents whose loaded metadata shows packing is enabled.
+         *      getNotifs of the target scatters the packed transfers received into
+         *      their destinations and acknowledges them, and the write completes on
+         *      the initiator once it receives the ack, so the target has to call
+         *      getNotifs and be able to send notifications to the initiator.
+         *      A target that does not call getNotifs stalls the packed writes to
+         *      it, give them a deadline (timeoutUs) to fail with NIXL_ERR_TIMEOUT
+         *      instead. The initiator reads its notifications to find the acks,
+         *      and holds the others till its own next getNotifs.
+         *      The threshold is not calibrated by the agent, pack_perf measures
+         *      the break-even of a given backend.
+         */
+        bool     packXfers       = false;
+        size_t   packMaxDescSize = 4096;
+
+        /**
+         * @var Collect per peer and per backend transfer telemetry for getStats
+         *      When disabled, the transfer path only checks a null pointer.
+         *      When enabled, each transfer request records its bytes and
+         *      descriptor counts, and its latency when a completion is observed.
+         */
+        bool     enableTelemetry = false;
+
+        /**
+         * @var File the agent stats are periodically written to (empty disables it)
+         *      Setting it enables telemetry. A background thread writes the stats
+         *      every statsExportPeriodUs in statsExportFormat, to a temporary file
+         *      that is then renamed over the path, so readers such as a Prometheus
+         *      textfile collector never see a partial file.
+         */
+        std::string      statsExportPath;
+        uint64_t         statsExportPeriodUs = 1000000;
+        nixl_stats_fmt_t statsExportFormat   = NIXL_STATS_PROMETHEUS;
+
+        /**
+         * @var Record a timeline of the transfer pipeline for dumpTrace
+         *      Tracing is process wide, and stays enabled once an agent enables
+         *      it. Each thread keeps its last traceRingSize spans (0 for 65536).
+         *      It can also be enabled with the NIXL_TRACE_FILE environment
+         *      variable, which writes the trace to that file at exit.
+         */
+        bool     enableTracing = false;
+        size_t   traceRingSize = 0;
+
         /**
          * @brief  Agent configuration constructor. Important configs such as
          *         useProgThread must be given and can't be changed.
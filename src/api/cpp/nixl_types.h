@@ -16,8 +16,11 @@
  */
 #ifndef _NIXL_TYPES_H
 #define _NIXL_TYPES_H
+#include <map>
+#include <array>
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <unordered_map>
 
 
@@ -26,6 +29,8 @@ class nixlSerDes;
 class nixlDlistH;
 class nixlBackendH;
 class nixlXferReqH;
+class nixlXferStreamH;
+class nixlRegReqH;
 class nixlAgentData;
 
 
@@ -44,6 +49,18 @@ typedef enum {DRAM_SEG, VRAM_SEG, BLK_SEG, OBJ_SEG, FILE_SEG} nixl_mem_t;
  */
 typedef enum {NIXL_READ, NIXL_WRITE} nixl_xfer_op_t;
 
+/**
+ * @enum   nixl_xfer_prio_t
+ * @brief  An enumeration of transfer priority classes for NIXL
+ */
+typedef enum {NIXL_PRIO_LOW, NIXL_PRIO_NORMAL, NIXL_PRIO_HIGH} nixl_xfer_prio_t;
+
+/**
+ * @enum   nixl_stats_fmt_t
+ * @brief  An enumeration of the text formats agent stats can be exported in
+ */
+typedef enum {NIXL_STATS_PROMETHEUS, NIXL_STATS_JSON} nixl_stats_fmt_t;
+
 /**
  * @enum   nixl_status_t
  * @brief  An enumeration of status values and error codes for NIXL
@@ -59,7 +76,9 @@ typedef enum {
     NIXL_ERR_NOT_ALLOWED = -6,
     NIXL_ERR_REPOST_ACTIVE = -7,
     NIXL_ERR_UNKNOWN = -8,
-    NIXL_ERR_NOT_SUPPORTED = -9
+    NIXL_ERR_NOT_SUPPORTED = -9,
+    NIXL_ERR_TIMEOUT = -10,
+    NIXL_ERR_OVER_LIMIT = -11
 } nixl_status_t;
 
 /**
@@ -134,6 +153,71 @@ class nixlAgentOptionalArgs {
          * @var makeXferReq boolean to skip merging consecutive descriptors, used in makeXferReq.
          */
         bool skipDescMerge = false;
+
+        /**
+         * @var numaNode NUMA node to bind new allocMem arenas to, -1 for no binding.
+         */
+        int numaNode = -1;
+
+        /**
+         * @var timeoutUs Deadline of a transfer in microseconds from each post, used in
+         *      createXferReq / makeXferReq / postXferReq. 0 means no deadline, or in
+         *      postXferReq to keep the one given at creation. A transfer still in
+         *      progress past it is canceled by getXferStatus, which returns NIXL_ERR_TIMEOUT.
+         *      There is no agent thread enforcing deadlines: they are checked when the
+         *      agent polls the transfer, in getXferStatus of the request, or when it
+         *      dispatches posts held by the scheduler (limits, priorities or dependencies),
+         *      which also covers the held posts and those in progress meanwhile. Transfers
+         *      with a deadline are not coalesced.
+         */
+        uint64_t timeoutUs = 0;
+
+        /**
+         * @var priority Priority class of a transfer, used in createXferReq / makeXferReq.
+         *      With priority scheduling enabled in the agent config, low priority posts
+         *      can be held back by the agent. Backends can also use it as a hint.
+         */
+        nixl_xfer_prio_t priority = NIXL_PRIO_NORMAL;
+
+        /**
+         * @var dependsOn Transfer requests of the same agent to wait for, used in
+         *      postXferReq. Each must be posted or completed. The post reads as in
+         *      progress, and is started by the agent once all of them completed, or
+         *      fails with NIXL_ERR_NOT_POSTED without being started if one did not.
+         *      Waiting posts are advanced from getXferStatus calls.
+         */
+        std::vector<nixlXferReqH*> dependsOn;
+
+        /**
+         * @var segments Number of descriptors of each segment of a transfer, used in
+         *      createXferReq / makeXferReq, which must add up to the descriptor count.
+         *      Each segment is posted as its own backend transfer, so getXferProgress
+         *      reports the segments completed while the others are still in progress.
+         *      makeXferReq does not merge the descriptors of a segmented transfer,
+         *      and createXferReq does not stripe it.
+         */
+        std::vector<int> segments;
+        /**
+         * @var segmentNotifs Optional notification message per segment, used along
+         *      segments. Each is sent to the remote agent with its segment, so it is
+         *      received once that segment is complete. Empty messages are not sent.
+         */
+        std::vector<nixl_blob_t> segmentNotifs;
+
+        /**
+         * @var packLocalStaging Staging buffers of a packed write, used in createXferReq /
+         *      makeXferReq when packXfers is enabled. packLocalStaging is in DRAM registered
+         *      by this agent and packRemoteStaging in DRAM registered by the remote agent,
+         *      both of packStagingLen bytes. A write of small enough descriptors that fits
+         *      in them is sent through them, and the remote agent copies the data to the
+         *      destination descriptors when getNotifs receives its notification. The
+         *      transfer is in progress till the remote agent acknowledged this copy,
+         *      and the staging buffers should only be used by one transfer in progress
+         *      at a time.
+         */
+        uintptr_t packLocalStaging  = 0;
+        uintptr_t packRemoteStaging = 0;
+        size_t    packStagingLen    = 0;
 };
 /**
  * @brief A typedef for a nixlAgentOptionalArgs
@@ -141,6 +225,128 @@ class nixlAgentOptionalArgs {
  */
 typedef nixlAgentOptionalArgs nixl_opt_args_t;
 
+/**
+ * @class nixlXferLimits
+ * @brief Limits on the transfers an agent posts to a remote agent or through a
+ *        backend, where 0 means no limit. Posts over a limit are held back by the
+ *        agent and started in order from getXferStatus calls, or rejected.
+ */
+class nixlXferLimits {
+    public:
+        /** @var rateBytesPerSec Sustained rate of the posted bytes per second */
+        uint64_t rateBytesPerSec  = 0;
+        /**
+         * @var burstBytes Bytes that can be posted at once when idle, 0 for one
+         *      second of rateBytesPerSec. A larger transfer can still start with
+         *      a full burst, and the following ones wait for the rate to catch up.
+         */
+        uint64_t burstBytes       = 0;
+        /**
+         * @var maxInflightBytes Bytes of the transfers in progress, a single
+         *      larger transfer can still start when nothing else is in progress
+         */
+        uint64_t maxInflightBytes = 0;
+        /** @var maxInflightReqs Number of transfers in progress */
+        uint64_t maxInflightReqs  = 0;
+        /**
+         * @var reject Fail the posts over a limit with NIXL_ERR_OVER_LIMIT instead of
+         *      holding them, leaving the request as it was to be posted again later
+         */
+        bool     reject           = false;
+};
+/**
+ * @brief A typedef for a nixlXferLimits
+ */
+typedef nixlXferLimits nixl_xfer_limits_t;
+
+/**
+ * @class nixlXferProgress
+ * @brief Progress of the current post of a transfer request, from getXferProgress
+ */
+class nixlXferProgress {
+    public:
+        /** @var doneBytes Bytes of the completed segments */
+        uint64_t          doneBytes  = 0;
+        /** @var totalBytes Bytes of the whole transfer */
+        uint64_t          totalBytes = 0;
+        /**
+         * @var segmentsDone Completion of each segment given at creation, or of the
+         *      whole transfer as a single segment if there were none
+         */
+        std::vector<bool> segmentsDone;
+};
+/**
+ * @brief A typedef for a nixlXferProgress
+ */
+typedef nixlXferProgress nixl_xfer_progress_t;
+
+/**
+ * @class nixlXferStats
+ * @brief Transfer counters of one peer or backend for one operation, from the
+ *        agent telemetry. Latencies are from post to completion observed by
+ *        getXferStatus (or a repost), so they include the polling interval.
+ */
+class nixlXferStats {
+    public:
+        /** @var postCount Transfers posted, the ones in flight are not completed or failed */
+        uint64_t postCount       = 0;
+        /** @var xferCount Transfers completed successfully */
+        uint64_t xferCount       = 0;
+        /** @var errorCount Transfers failed, timed out or canceled while in progress */
+        uint64_t errorCount      = 0;
+        /** @var totalBytes Bytes of the successful transfers */
+        uint64_t totalBytes      = 0;
+        /** @var descCount Descriptors given by the user for the successful transfers */
+        uint64_t descCount       = 0;
+        /** @var postedDescCount Descriptors passed to the backend, after merging */
+        uint64_t postedDescCount = 0;
+        /** @var totalNs Sum of the latencies of the successful transfers */
+        uint64_t totalNs         = 0;
+        /** @var maxNs Largest latency of a successful transfer */
+        uint64_t maxNs           = 0;
+        /**
+         * @var latencyBuckets Latency histogram of the successful transfers, where
+         *      bucket i counts the latencies in [2^i, 2^(i+1)) nanoseconds.
+         */
+        std::array<uint64_t, 64> latencyBuckets{};
+
+        /**
+         * @brief  Estimate a latency percentile from the histogram, interpolating
+         *         within the bucket it falls in.
+         *
+         * @param  pct  Percentile in [0, 100]
+         * @return Latency in nanoseconds, 0 if there were no transfers
+         */
+        uint64_t getPercentileNs(const double &pct) const;
+};
+
+/**
+ * @class nixlAgentStats
+ * @brief Snapshot of the agent telemetry, returned by getStats. Each entry has
+ *        the stats of NIXL_READ and NIXL_WRITE transfers, indexed by the operation.
+ */
+class nixlAgentStats {
+    public:
+        /** @var peers Stats per remote agent name */
+        std::map<std::string, std::array<nixlXferStats, 2>>    peers;
+        /** @var backends Stats per backend of the agent */
+        std::map<nixl_backend_t, std::array<nixlXferStats, 2>> backends;
+        /**
+         * @var backendCounters Other counters per backend, such as registered_bytes
+         *      (registered through the agent and not deregistered), and the ones
+         *      specific to the backend, e.g., progress_iterations and rkeys_imported.
+         */
+        std::map<nixl_backend_t, std::map<std::string, uint64_t>> backendCounters;
+        /** @var notifsSent Notifications sent, standalone or with a transfer post */
+        uint64_t notifsSent     = 0;
+        /** @var notifsReceived Notifications returned by getNotifs */
+        uint64_t notifsReceived = 0;
+};
+/**
+ * @brief A typedef for a nixlAgentStats
+ */
+typedef nixlAgentStats nixl_agent_stats_t;
+
 /**
  * @brief A define for an empty string, that indicates the descriptor list is being
  *        prepared for the local agent as an initiator in prepXferDlist method.
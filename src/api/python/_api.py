@@ -24,6 +24,7 @@ import nixl._bindings as nixlBind
 nixl_backend_handle = int
 nixl_prepped_dlist_handle = int
 nixl_xfer_handle = int
+nixl_xfer_stream = int
 
 """
 @brief Configuration class for NIXL agent.
@@ -32,14 +33,80 @@ nixl_xfer_handle = int
 @param backends List of backend names for agent to initialize.
         Default is UCX, other backends can be added to the list, or after
         agent creation, can be initialized with create_backend.
+@param reg_cache_size Byte budget of the registration cache, 0 disables it.
+@param coalesce_regs Whether to register overlapping or adjacent memory as one region.
+@param alloc_arena_size Minimum size in bytes of the arenas allocMem registers.
+@param enable_telemetry Whether to collect transfer telemetry, see get_stats.
+@param stats_export_path File the stats are periodically written to, empty for none.
+        Setting it enables telemetry.
+@param stats_export_period_us Period of the stats export in microseconds.
+@param stats_export_json Whether to export JSON instead of the Prometheus text format.
+@param enable_tracing Whether to record a timeline of transfers, see dump_trace.
+@param stripe_xfers Whether to split each transfer across all the backends that can do it.
+@param stripe_chunk_size Descriptors are only split at multiples of it, 0 keeps them whole.
+@param prio_inflight_bytes In-flight bytes over which "LOW" priority transfers are held back,
+        0 disables priority scheduling.
+@param coalesce_max_reqs Number of small transfers to the same agent merged into one backend
+        transfer, 0 or 1 disables coalescing.
+@param coalesce_max_bytes Size up to which a transfer can be coalesced.
+@param coalesce_window_us Time after which the transfers gathered so far are posted.
+@param local_copy Whether to copy DRAM transfers of the agent to itself within the process.
+@param local_copy_threads Worker threads of the local copies, 0 copies within the post.
+@param local_copy_async_bytes Size from which a local copy is done by the worker threads.
+@param pack_xfers Whether to pack writes of many small descriptors given staging buffers,
+        and to unpack the ones received. Writes are only packed to agents that enabled it,
+        and complete once the target unpacked them from get_new_notifs.
+@param pack_max_desc_size Average descriptor size up to which such writes are packed.
 """
 
 
 class nixl_agent_config:
-    def __init__(self, enable_prog_thread=True, backends=["UCX"]):
+    def __init__(
+        self,
+        enable_prog_thread=True,
+        backends=["UCX"],
+        reg_cache_size=0,
+        coalesce_regs=False,
+        alloc_arena_size=0,
+        enable_telemetry=False,
+        stats_export_path="",
+        stats_export_period_us=1000000,
+        stats_export_json=False,
+        enable_tracing=False,
+        stripe_xfers=False,
+        stripe_chunk_size=0,
+        prio_inflight_bytes=0,
+        coalesce_max_reqs=0,
+        coalesce_max_bytes=65536,
+        coalesce_window_us=20,
+        local_copy=False,
+        local_copy_threads=4,
+        local_copy_async_bytes=1048576,
+        pack_xfers=False,
+        pack_max_desc_size=4096,
+    ):
         # TODO: add backend init parameters
         self.backends = backends
         self.enable_pthread = enable_prog_thread
+        self.reg_cache_size = reg_cache_size
+        self.coalesce_regs = coalesce_regs
+        self.alloc_arena_size = alloc_arena_size
+        self.enable_telemetry = enable_telemetry
+        self.stats_export_path = stats_export_path
+        self.stats_export_period_us = stats_export_period_us
+        self.stats_export_json = stats_export_json
+        self.enable_tracing = enable_tracing
+        self.stripe_xfers = stripe_xfers
+        self.stripe_chunk_size = stripe_chunk_size
+        self.prio_inflight_bytes = prio_inflight_bytes
+        self.coalesce_max_reqs = coalesce_max_reqs
+        self.coalesce_max_bytes = coalesce_max_bytes
+        self.coalesce_window_us = coalesce_window_us
+        self.local_copy = local_copy
+        self.local_copy_threads = local_copy_threads
+        self.local_copy_async_bytes = local_copy_async_bytes
+        self.pack_xfers = pack_xfers
+        self.pack_max_desc_size = pack_max_desc_size
 
 
 """
@@ -70,6 +137,29 @@ class nixl_agent:
 
         # Set agent config and instantiate an agent
         agent_config = nixlBind.nixlAgentConfig(nixl_conf.enable_pthread)
+        agent_config.regCacheSize = nixl_conf.reg_cache_size
+        agent_config.coalesceRegs = nixl_conf.coalesce_regs
+        agent_config.allocArenaSize = nixl_conf.alloc_arena_size
+        agent_config.enableTelemetry = nixl_conf.enable_telemetry
+        agent_config.statsExportPath = nixl_conf.stats_export_path
+        agent_config.statsExportPeriodUs = nixl_conf.stats_export_period_us
+        agent_config.statsExportFormat = (
+            nixlBind.NIXL_STATS_JSON
+            if nixl_conf.stats_export_json
+            else nixlBind.NIXL_STATS_PROMETHEUS
+        )
+        agent_config.enableTracing = nixl_conf.enable_tracing
+        agent_config.stripeXfers = nixl_conf.stripe_xfers
+        agent_config.stripeChunkSize = nixl_conf.stripe_chunk_size
+        agent_config.prioInflightBytes = nixl_conf.prio_inflight_bytes
+        agent_config.coalesceMaxReqs = nixl_conf.coalesce_max_reqs
+        agent_config.coalesceMaxBytes = nixl_conf.coalesce_max_bytes
+        agent_config.coalesceWindowUs = nixl_conf.coalesce_window_us
+        agent_config.localCopy = nixl_conf.local_copy
+        agent_config.localCopyThreads = nixl_conf.local_copy_threads
+        agent_config.localCopyAsyncBytes = nixl_conf.local_copy_async_bytes
+        agent_config.packXfers = nixl_conf.pack_xfers
+        agent_config.packMaxDescSize = nixl_conf.pack_max_desc_size
         self.agent = nixlBind.nixlAgent(agent_name, agent_config)
 
         self.name = agent_name
@@ -122,6 +212,12 @@ class nixl_agent:
             "READ": nixlBind.NIXL_READ,
         }
 
+        self.nixl_prios = {
+            "LOW": nixlBind.NIXL_PRIO_LOW,
+            "NORMAL": nixlBind.NIXL_PRIO_NORMAL,
+            "HIGH": nixlBind.NIXL_PRIO_HIGH,
+        }
+
         print("Initialized NIXL agent:", agent_name)
 
     """
@@ -332,6 +428,11 @@ class nixl_agent:
            notif_msg should be bytes, as that is what will be returned to the target, but will work with str too.
     @param backends Optional list of backend names to limit which backends NIXL can use.
     @param skip_desc_merge Whether to skip descriptor merging optimization.
+    @param priority Priority class of the transfer ("LOW", "NORMAL" or "HIGH").
+    @param segments Optional number of descriptors of each segment, see get_xfer_progress.
+    @param segment_notifs Optional notification message per segment, sent with its segment.
+    @param pack_staging Optional (local address, remote address, length) of registered staging
+           buffers, to pack a write of small descriptors when pack_xfers is enabled.
     @return Opaque handle for posting/checking transfer.
     """
 
@@ -345,6 +446,10 @@ class nixl_agent:
         notif_msg: bytes = b"",
         backends: list[str] = [],
         skip_desc_merge: bool = False,
+        priority: str = "NORMAL",
+        segments: list[int] = [],
+        segment_notifs: list[bytes] = [],
+        pack_staging: tuple[int, int, int] = (0, 0, 0),
     ) -> nixl_xfer_handle:
         op = self.nixl_ops[operation]
         if op:
@@ -361,6 +466,12 @@ class nixl_agent:
                 notif_msg,
                 handle_list,
                 skip_desc_merge,
+                priority=self.nixl_prios[priority],
+                segments=segments,
+                segment_notifs=segment_notifs,
+                pack_local_staging=pack_staging[0],
+                pack_remote_staging=pack_staging[1],
+                pack_staging_len=pack_staging[2],
             )
 
             return handle
@@ -382,6 +493,11 @@ class nixl_agent:
     @param notif_msg Optional notification message.
            notif_msg should be bytes, as that is what will be returned to the target, but will work with str too.
     @param backends Optional list of backend names to limit which backends NIXL can use.
+    @param priority Priority class of the transfer ("LOW", "NORMAL" or "HIGH").
+    @param segments Optional number of descriptors of each segment, see get_xfer_progress.
+    @param segment_notifs Optional notification message per segment, sent with its segment.
+    @param pack_staging Optional (local address, remote address, length) of registered staging
+           buffers, to pack a write of small descriptors when pack_xfers is enabled.
     @return Opaque handle for posting/checking transfer.
     """
 
@@ -393,6 +509,10 @@ class nixl_agent:
         remote_agent: str,
         notif_msg: bytes = b"",
         backends: list[str] = [],
+        priority: str = "NORMAL",
+        segments: list[int] = [],
+        segment_notifs: list[bytes] = [],
+        pack_staging: tuple[int, int, int] = (0, 0, 0),
     ) -> nixl_xfer_handle:
         op = self.nixl_ops[operation]
         if op:
@@ -401,7 +521,18 @@ class nixl_agent:
                 handle_list.append(self.backends[backend_string])
 
             handle = self.agent.createXferReq(
-                op, local_descs, remote_descs, remote_agent, notif_msg, handle_list
+                op,
+                local_descs,
+                remote_descs,
+                remote_agent,
+                notif_msg,
+                handle_list,
+                priority=self.nixl_prios[priority],
+                segments=segments,
+                segment_notifs=segment_notifs,
+                pack_local_staging=pack_staging[0],
+                pack_remote_staging=pack_staging[1],
+                pack_staging_len=pack_staging[2],
             )
 
             return handle
@@ -409,6 +540,156 @@ class nixl_agent:
             raise nixlBind.nixlInvalidParamError("Invalid op code")
             return nixlBind.nixlInvalidParamError
 
+    """
+    @brief  Prepare a broadcast, writing the same local descriptors to several remote agents,
+            e.g. the same KV prefix to several replicas. The local side is prepared once and shared
+            by all the destinations. The transfer is "DONE" once all of them are done, and the
+            notification is sent to each of them when its own write completed.
+
+    @param local_xfer_side Local prepared descriptor list handle, from make_prepped_dlist.
+    @param local_indices List of indices to the local prepared descriptor list.
+    @param remote_xfer_sides Remote prepared descriptor list handles, one per destination.
+    @param remote_indices List of indices to each of the remote prepared descriptor lists.
+    @param notif_msg Optional notification message, sent to each destination.
+    @param backends Optional list of backend names to limit which backends NIXL can use.
+    @param priority Priority class of the transfer ("LOW", "NORMAL" or "HIGH").
+    @return Opaque handle for posting/checking transfer.
+    """
+
+    def make_prepped_bcast_xfer(
+        self,
+        local_xfer_side: nixl_prepped_dlist_handle,
+        local_indices: list[int],
+        remote_xfer_sides: list[nixl_prepped_dlist_handle],
+        remote_indices: list[int],
+        notif_msg: bytes = b"",
+        backends: list[str] = [],
+        priority: str = "NORMAL",
+    ) -> nixl_xfer_handle:
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+
+        return self.agent.makeBcastXferReq(
+            local_xfer_side,
+            local_indices,
+            remote_xfer_sides,
+            remote_indices,
+            notif_msg,
+            handle_list,
+            priority=self.nixl_prios[priority],
+        )
+
+    """
+    @brief  Initialize a broadcast from a local descriptor list and a descriptor list per remote
+            agent, combined API same as make_prepped_bcast_xfer over prepared lists.
+
+    @param local_descs List of local transfer descriptors, from get_xfer_descs.
+    @param remote_descs Lists of remote transfer descriptors, one per destination.
+    @param remote_agents Names of the remote agents, one per destination.
+    @param notif_msg Optional notification message, sent to each destination.
+    @param backends Optional list of backend names to limit which backends NIXL can use.
+    @param priority Priority class of the transfer ("LOW", "NORMAL" or "HIGH").
+    @return Opaque handle for posting/checking transfer.
+    """
+
+    def initialize_bcast_xfer(
+        self,
+        local_descs: nixlBind.nixlXferDList,
+        remote_descs: list[nixlBind.nixlXferDList],
+        remote_agents: list[str],
+        notif_msg: bytes = b"",
+        backends: list[str] = [],
+        priority: str = "NORMAL",
+    ) -> nixl_xfer_handle:
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+
+        return self.agent.createBcastXferReq(
+            local_descs,
+            remote_descs,
+            remote_agents,
+            notif_msg,
+            handle_list,
+            priority=self.nixl_prios[priority],
+        )
+
+    """
+    @brief  Prepare a gather, reading from several remote agents into local descriptors, e.g. KV
+            blocks spread across several workers, as one transfer. The reads from all the sources
+            are in flight together, and the transfer is "DONE" once all of them are done. The
+            notification is sent to each source when its own reads completed.
+
+    @param local_xfer_side Local prepared descriptor list handle, from make_prepped_dlist.
+    @param local_indices Lists of indices to the local prepared descriptor list, one per source.
+    @param remote_xfer_sides Remote prepared descriptor list handles, one per source.
+    @param remote_indices Lists of indices to each of the remote prepared descriptor lists.
+    @param notif_msg Optional notification message, sent to each source.
+    @param backends Optional list of backend names to limit which backends NIXL can use.
+    @param priority Priority class of the transfer ("LOW", "NORMAL" or "HIGH").
+    @return Opaque handle for posting/checking transfer.
+    """
+
+    def make_prepped_gather_xfer(
+        self,
+        local_xfer_side: nixl_prepped_dlist_handle,
+        local_indices: list[list[int]],
+        remote_xfer_sides: list[nixl_prepped_dlist_handle],
+        remote_indices: list[list[int]],
+        notif_msg: bytes = b"",
+        backends: list[str] = [],
+        priority: str = "NORMAL",
+    ) -> nixl_xfer_handle:
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+
+        return self.agent.makeGatherXferReq(
+            local_xfer_side,
+            local_indices,
+            remote_xfer_sides,
+            remote_indices,
+            notif_msg,
+            handle_list,
+            priority=self.nixl_prios[priority],
+        )
+
+    """
+    @brief  Initialize a gather from a local and a remote descriptor list per source agent,
+            combined API same as make_prepped_gather_xfer over prepared lists.
+
+    @param local_descs Lists of local transfer descriptors, one per source.
+    @param remote_descs Lists of remote transfer descriptors, one per source.
+    @param remote_agents Names of the remote agents, one per source.
+    @param notif_msg Optional notification message, sent to each source.
+    @param backends Optional list of backend names to limit which backends NIXL can use.
+    @param priority Priority class of the transfer ("LOW", "NORMAL" or "HIGH").
+    @return Opaque handle for posting/checking transfer.
+    """
+
+    def initialize_gather_xfer(
+        self,
+        local_descs: list[nixlBind.nixlXferDList],
+        remote_descs: list[nixlBind.nixlXferDList],
+        remote_agents: list[str],
+        notif_msg: bytes = b"",
+        backends: list[str] = [],
+        priority: str = "NORMAL",
+    ) -> nixl_xfer_handle:
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+
+        return self.agent.createGatherXferReq(
+            local_descs,
+            remote_descs,
+            remote_agents,
+            notif_msg,
+            handle_list,
+            priority=self.nixl_prios[priority],
+        )
+
     """
     @brief  Initiate a data transfer operation.
             After calling this, the transfer state can be checked asynchronously till completion.
@@ -418,11 +699,20 @@ class nixl_agent:
     @param handle Handle to the transfer operation, from make_prepped_xfer, or initialize_xfer.
     @param notif_msg Optional notification message can be specified or updated per transfer call.
            notif_msg should be bytes, as that is what will be returned to the target, but will work with str too.
+    @param depends_on Optional list of transfer handles of this agent, already posted, to chain the
+           transfer after. It reads as "PROC" and the agent starts it once all of them are done,
+           advancing from check_xfer_state calls. If one of them fails, so does this transfer.
+           With depends_on, notif_msg replaces the notification given at creation, none if empty.
     @return Status of the transfer operation ("DONE", "PROC", or "ERR").
     """
 
-    def transfer(self, handle: nixl_xfer_handle, notif_msg: bytes = b"") -> str:
-        status = self.agent.postXferReq(handle, notif_msg)
+    def transfer(
+        self,
+        handle: nixl_xfer_handle,
+        notif_msg: bytes = b"",
+        depends_on: list[nixl_xfer_handle] = [],
+    ) -> str:
+        status = self.agent.postXferReq(handle, notif_msg, depends_on)
         if status == nixlBind.NIXL_SUCCESS:
             return "DONE"
         elif status == nixlBind.NIXL_IN_PROG:
@@ -446,6 +736,136 @@ class nixl_agent:
         else:
             return "ERR"
 
+    """
+    @brief Check the state of a transfer operation, and which of its segments completed,
+           so they can be consumed while the others are still in progress.
+
+    @param handle Handle to the transfer operation, from make_prepped_xfer, or initialize_xfer.
+    @return Tuple of the state ("DONE", "PROC", or "ERR"), the completed bytes, the total bytes,
+            and a list with the completion of each segment, a single one if not segmented.
+    """
+
+    def get_xfer_progress(
+        self, handle: nixl_xfer_handle
+    ) -> tuple[str, int, int, list[bool]]:
+        status, done_bytes, total_bytes, segments_done = self.agent.getXferProgress(
+            handle
+        )
+        if status == nixlBind.NIXL_SUCCESS:
+            state = "DONE"
+        elif status == nixlBind.NIXL_IN_PROG:
+            state = "PROC"
+        else:
+            state = "ERR"
+        return (state, done_bytes, total_bytes, segments_done)
+
+    """
+    @brief Cancel a transfer operation if it is in progress. This does not fail when the
+           backend cannot abort right away, the agent aborts it later instead.
+           A canceled handle can only be released.
+
+    @param handle Handle to the transfer operation from initialize_xfer or make_xfer.
+    """
+
+    def cancel_xfer(self, handle: nixl_xfer_handle):
+        self.agent.cancelXferReq(handle)
+
+    """
+    @brief Get the transfer telemetry of the agent, which must have been created
+           with enable_telemetry in its nixl_agent_config.
+
+    @return Dict with "peers" and "backends" entries, each mapping a remote agent
+            or backend name to a "READ" and a "WRITE" dict of counters, latency
+            percentiles and the latency histogram (bucket i is [2^i, 2^(i+1)) ns).
+            Also has "backend_counters" per backend, "notifs_sent" and "notifs_received".
+    """
+
+    def get_stats(self) -> dict:
+        return self.agent.getStats()
+
+    """
+    @brief Serialize the transfer telemetry, e.g., to serve it from an HTTP endpoint.
+           It is what the exporter writes to stats_export_path of nixl_agent_config.
+
+    @param json Whether to use JSON instead of the Prometheus text format.
+    @return The serialized stats.
+    """
+
+    def export_stats(self, json: bool = False) -> str:
+        return self.agent.exportStats(
+            nixlBind.NIXL_STATS_JSON if json else nixlBind.NIXL_STATS_PROMETHEUS
+        )
+
+    """
+    @brief Write the recorded timeline of the process as a Chrome trace JSON file,
+           to be opened in chrome://tracing or Perfetto. Tracing is enabled with
+           enable_tracing in nixl_agent_config, or the NIXL_TRACE_FILE variable.
+
+    @param path Output file path.
+    """
+
+    def dump_trace(self, path: str):
+        self.agent.dumpTrace(path)
+
+    """
+    @brief Limit the transfers posted to a remote agent, 0 means no limit. Transfers over
+           the limits are held back and reported as "PROC" till the agent starts them from
+           check_xfer_state calls, or with reject, transfer raises nixlOverLimitError.
+
+    @param remote_agent Name of the remote agent, it does not need to be loaded yet.
+    @param rate_bytes_per_sec Sustained rate of the posted bytes.
+    @param burst_bytes Bytes that can be posted at once, 0 for one second of the rate.
+    @param max_inflight_bytes Bytes of the transfers in progress.
+    @param max_inflight_reqs Number of transfers in progress.
+    @param reject Whether to reject the transfers over the limits instead of holding them.
+    """
+
+    def set_peer_limits(
+        self,
+        remote_agent: str,
+        rate_bytes_per_sec: int = 0,
+        burst_bytes: int = 0,
+        max_inflight_bytes: int = 0,
+        max_inflight_reqs: int = 0,
+        reject: bool = False,
+    ):
+        limits = self._make_limits(
+            rate_bytes_per_sec, burst_bytes, max_inflight_bytes, max_inflight_reqs, reject
+        )
+        self.agent.setPeerLimits(remote_agent, limits)
+
+    """
+    @brief Limit the transfers posted through a backend to all the remote agents, with the
+           same arguments as set_peer_limits.
+
+    @param backend Name of the backend.
+    """
+
+    def set_backend_limits(
+        self,
+        backend: str,
+        rate_bytes_per_sec: int = 0,
+        burst_bytes: int = 0,
+        max_inflight_bytes: int = 0,
+        max_inflight_reqs: int = 0,
+        reject: bool = False,
+    ):
+        limits = self._make_limits(
+            rate_bytes_per_sec, burst_bytes, max_inflight_bytes, max_inflight_reqs, reject
+        )
+        self.agent.setBackendLimits(self.backends[backend], limits)
+
+    def _make_limits(
+        self, rate_bytes_per_sec, burst_bytes, max_inflight_bytes, max_inflight_reqs, reject
+    ):
+        limits = nixlBind.nixlXferLimits()
+        limits.rateBytesPerSec = rate_bytes_per_sec
+        limits.burstBytes = burst_bytes
+        limits.maxInflightBytes = max_inflight_bytes
+        limits.maxInflightReqs = max_inflight_reqs
+        limits.reject = reject
+        return limits
+
     """
     @brief Query the backend that was chosen for a transfer operation.
 
@@ -473,6 +893,62 @@ class nixl_agent:
     def release_xfer_handle(self, handle: nixl_xfer_handle):
         self.agent.releaseXferReq(handle)
 
+    """
+    @brief  Create a stream over a segmented transfer handle, to post its segments one at a time
+            as chunks, e.g. each layer as soon as it is computed. Once all the chunks are done,
+            the next post_chunk starts over from the first. The transfer handle cannot be
+            transferred or released while it has a stream.
+
+    @param handle Handle to a transfer operation made with segments, not in progress.
+    @return Opaque handle for posting/checking chunks.
+    """
+
+    def create_xfer_stream(self, handle: nixl_xfer_handle) -> nixl_xfer_stream:
+        return self.agent.createXferStream(handle)
+
+    """
+    @brief  Post the next chunk of a stream. Chunk notifications reach the target in chunk order.
+
+    @param stream Stream handle from create_xfer_stream.
+    @param notif_msg Optional notification of the chunk, the segment one if empty.
+    @return Status of the stream ("DONE", "PROC", or "ERR").
+    """
+
+    def post_chunk(self, stream: nixl_xfer_stream, notif_msg: bytes = b"") -> str:
+        status = self.agent.postXferChunk(stream, notif_msg)
+        if status == nixlBind.NIXL_SUCCESS:
+            return "DONE"
+        elif status == nixlBind.NIXL_IN_PROG:
+            return "PROC"
+        else:
+            return "ERR"
+
+    """
+    @brief  Check the state of a stream, sending the pending notifications of its completed chunks.
+
+    @param stream Stream handle from create_xfer_stream.
+    @return "DONE" once all the chunks are done, otherwise "PROC" or "ERR".
+    """
+
+    def check_stream_state(self, stream: nixl_xfer_stream) -> str:
+        status = self.agent.getXferStreamStatus(stream)
+        if status == nixlBind.NIXL_SUCCESS:
+            return "DONE"
+        elif status == nixlBind.NIXL_IN_PROG:
+            return "PROC"
+        else:
+            return "ERR"
+
+    """
+    @brief  Release a stream, canceling its chunks in progress. Its transfer handle can then be
+            transferred or released again.
+
+    @param stream Stream handle from create_xfer_stream.
+    """
+
+    def release_xfer_stream(self, stream: nixl_xfer_stream):
+        self.agent.releaseXferStream(stream)
+
     """
     @brief Release a descriptor list handle, which internally frees the memory used for the handle.
 
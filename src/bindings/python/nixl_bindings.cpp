@@ -72,6 +72,16 @@ class nixlNotSupportedError : public std::runtime_error {
         nixlNotSupportedError(const char* what) : runtime_error(what) {}
 };
 
+class nixlTimeoutError : public std::runtime_error {
+    public:
+        nixlTimeoutError(const char* what) : runtime_error(what) {}
+};
+
+class nixlOverLimitError : public std::runtime_error {
+    public:
+        nixlOverLimitError(const char* what) : runtime_error(what) {}
+};
+
 class nixlUnknownError : public std::runtime_error {
     public:
         nixlUnknownError(const char* what) : runtime_error(what) {}
@@ -108,6 +118,12 @@ void throw_nixl_exception(const nixl_status_t &status) {
         case NIXL_ERR_NOT_SUPPORTED:
             throw nixlNotSupportedError(nixlEnumStrings::statusStr(status).c_str());
             break;
+        case NIXL_ERR_TIMEOUT:
+            throw nixlTimeoutError(nixlEnumStrings::statusStr(status).c_str());
+            break;
+        case NIXL_ERR_OVER_LIMIT:
+            throw nixlOverLimitError(nixlEnumStrings::statusStr(status).c_str());
+            break;
         default:
             throw std::runtime_error("BAD_STATUS");
     }
@@ -134,6 +150,17 @@ PYBIND11_MODULE(_bindings, m) {
         .value("NIXL_WRITE", NIXL_WRITE)
         .export_values();
 
+    py::enum_<nixl_xfer_prio_t>(m, "nixl_xfer_prio_t")
+        .value("NIXL_PRIO_LOW", NIXL_PRIO_LOW)
+        .value("NIXL_PRIO_NORMAL", NIXL_PRIO_NORMAL)
+        .value("NIXL_PRIO_HIGH", NIXL_PRIO_HIGH)
+        .export_values();
+
+    py::enum_<nixl_stats_fmt_t>(m, "nixl_stats_fmt_t")
+        .value("NIXL_STATS_PROMETHEUS", NIXL_STATS_PROMETHEUS)
+        .value("NIXL_STATS_JSON", NIXL_STATS_JSON)
+        .export_values();
+
     py::enum_<nixl_status_t>(m, "nixl_status_t")
         .value("NIXL_IN_PROG", NIXL_IN_PROG)
         .value("NIXL_SUCCESS", NIXL_SUCCESS)
@@ -146,6 +173,8 @@ PYBIND11_MODULE(_bindings, m) {
         .value("NIXL_ERR_REPOST_ACTIVE", NIXL_ERR_REPOST_ACTIVE)
         .value("NIXL_ERR_UNKNOWN", NIXL_ERR_UNKNOWN)
         .value("NIXL_ERR_NOT_SUPPORTED", NIXL_ERR_NOT_SUPPORTED)
+        .value("NIXL_ERR_TIMEOUT", NIXL_ERR_TIMEOUT)
+        .value("NIXL_ERR_OVER_LIMIT", NIXL_ERR_OVER_LIMIT)
         .export_values();
 
     py::register_exception<nixlNotPostedError>(m, "nixlNotPostedError");
@@ -157,6 +186,8 @@ PYBIND11_MODULE(_bindings, m) {
     py::register_exception<nixlRepostActiveError>(m, "nixlRepostActiveError");
     py::register_exception<nixlUnknownError>(m, "nixlUnknownError");
     py::register_exception<nixlNotSupportedError>(m, "nixlNotSupportedError");
+    py::register_exception<nixlTimeoutError>(m, "nixlTimeoutError");
+    py::register_exception<nixlOverLimitError>(m, "nixlOverLimitError");
 
     py::class_<nixl_xfer_dlist_t>(m, "nixlXferDList")
         .def(py::init<nixl_mem_t, bool, int>(), py::arg("type"), py::arg("sorted")=false, py::arg("init_size")=0)
@@ -276,9 +307,38 @@ PYBIND11_MODULE(_bindings, m) {
             }
         ));
 
+    py::class_<nixl_xfer_limits_t>(m, "nixlXferLimits")
+        .def(py::init<>())
+        .def_readwrite("rateBytesPerSec", &nixl_xfer_limits_t::rateBytesPerSec)
+        .def_readwrite("burstBytes", &nixl_xfer_limits_t::burstBytes)
+        .def_readwrite("maxInflightBytes", &nixl_xfer_limits_t::maxInflightBytes)
+        .def_readwrite("maxInflightReqs", &nixl_xfer_limits_t::maxInflightReqs)
+        .def_readwrite("reject", &nixl_xfer_limits_t::reject);
+
     py::class_<nixlAgentConfig>(m, "nixlAgentConfig")
         //implicit constructor
-        .def(py::init<bool>());
+        .def(py::init<bool>())
+        .def_readwrite("regCacheSize", &nixlAgentConfig::regCacheSize)
+        .def_readwrite("coalesceRegs", &nixlAgentConfig::coalesceRegs)
+        .def_readwrite("allocArenaSize", &nixlAgentConfig::allocArenaSize)
+        .def_readwrite("enableTelemetry", &nixlAgentConfig::enableTelemetry)
+        .def_readwrite("statsExportPath", &nixlAgentConfig::statsExportPath)
+        .def_readwrite("statsExportPeriodUs", &nixlAgentConfig::statsExportPeriodUs)
+        .def_readwrite("statsExportFormat", &nixlAgentConfig::statsExportFormat)
+        .def_readwrite("enableTracing", &nixlAgentConfig::enableTracing)
+        .def_readwrite("traceRingSize", &nixlAgentConfig::traceRingSize)
+        .def_readwrite("stripeXfers", &nixlAgentConfig::stripeXfers)
+        .def_readwrite("stripeChunkSize", &nixlAgentConfig::stripeChunkSize)
+        .def_readwrite("prioInflightBytes", &nixlAgentConfig::prioInflightBytes)
+        .def_readwrite("peerLimits", &nixlAgentConfig::peerLimits)
+        .def_readwrite("coalesceMaxReqs", &nixlAgentConfig::coalesceMaxReqs)
+        .def_readwrite("coalesceMaxBytes", &nixlAgentConfig::coalesceMaxBytes)
+        .def_readwrite("coalesceWindowUs", &nixlAgentConfig::coalesceWindowUs)
+        .def_readwrite("localCopy", &nixlAgentConfig::localCopy)
+        .def_readwrite("localCopyThreads", &nixlAgentConfig::localCopyThreads)
+        .def_readwrite("localCopyAsyncBytes", &nixlAgentConfig::localCopyAsyncBytes)
+        .def_readwrite("packXfers", &nixlAgentConfig::packXfers)
+        .def_readwrite("packMaxDescSize", &nixlAgentConfig::packMaxDescSize);
 
     //note: pybind will automatically convert notif_map to python types:
     //so, a Dictionary of string: List<string>
@@ -333,6 +393,48 @@ PYBIND11_MODULE(_bindings, m) {
                     throw_nixl_exception(ret);
                     return ret;
                 }, py::arg("descs"), py::arg("backends") = std::vector<uintptr_t>({}))
+        .def("registerMemAsync", [](nixlAgent &agent, nixl_reg_dlist_t descs, std::vector<uintptr_t> backends) -> uintptr_t {
+                    nixlRegReqH* handle = nullptr;
+                    nixl_opt_args_t extra_params;
+                    for(uintptr_t backend: backends)
+                        extra_params.backends.push_back((nixlBackendH*) backend);
+
+                    throw_nixl_exception(agent.registerMemAsync(descs, handle, &extra_params));
+                    return (uintptr_t) handle;
+                }, py::arg("descs"), py::arg("backends") = std::vector<uintptr_t>({}))
+        .def("getRegStatus", [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
+                    nixl_status_t ret = agent.getRegStatus((nixlRegReqH*) reqh);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
+        .def("releaseRegReq", [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
+                    nixl_status_t ret = agent.releaseRegReq((nixlRegReqH*) reqh);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
+        .def("releasedMem", [](nixlAgent &agent, nixl_xfer_dlist_t descs) -> nixl_status_t {
+                    nixl_status_t ret = agent.releasedMem(descs);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
+        .def("allocMem", [](nixlAgent &agent, size_t size, nixl_mem_t mem_type,
+                            std::vector<uintptr_t> backends, int numa_node) -> py::tuple {
+                    nixl_opt_args_t extra_params;
+                    nixlBlobDesc desc;
+                    for(uintptr_t backend: backends)
+                        extra_params.backends.push_back((nixlBackendH*) backend);
+                    extra_params.numaNode = numa_node;
+
+                    nixl_status_t ret = agent.allocMem(size, mem_type, desc, &extra_params);
+                    throw_nixl_exception(ret);
+                    return py::make_tuple(desc.addr, desc.len, desc.devId);
+                }, py::arg("size"), py::arg("mem_type") = DRAM_SEG,
+                   py::arg("backends") = std::vector<uintptr_t>({}), py::arg("numa_node") = -1)
+        .def("freeMem", [](nixlAgent &agent, uintptr_t addr, size_t len, uint32_t dev_id) -> nixl_status_t {
+                    nixl_status_t ret = agent.freeMem(nixlBlobDesc(addr, len, dev_id));
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
         .def("makeConnection", [](nixlAgent &agent,
                                   const std::string &remote_agent,
                                   std::vector<uintptr_t> backends) {
@@ -367,10 +469,25 @@ PYBIND11_MODULE(_bindings, m) {
                                const std::vector<int> &remote_indices,
                                const std::string &notif_msg,
                                std::vector<uintptr_t> backends,
-                               bool skip_desc_merge) -> uintptr_t {
+                               bool skip_desc_merge,
+                               uint64_t timeout_us,
+                               nixl_xfer_prio_t priority,
+                               std::vector<int> segments,
+                               std::vector<std::string> segment_notifs,
+                               uintptr_t pack_local_staging,
+                               uintptr_t pack_remote_staging,
+                               size_t pack_staging_len) -> uintptr_t {
                     nixlXferReqH* handle = nullptr;
                     nixl_opt_args_t extra_params;
 
+                    extra_params.timeoutUs         = timeout_us;
+                    extra_params.priority          = priority;
+                    extra_params.segments          = segments;
+                    extra_params.segmentNotifs     = segment_notifs;
+                    extra_params.packLocalStaging  = pack_local_staging;
+                    extra_params.packRemoteStaging = pack_remote_staging;
+                    extra_params.packStagingLen    = pack_staging_len;
+
                     for(uintptr_t backend: backends)
                         extra_params.backends.push_back((nixlBackendH*) backend);
 
@@ -389,17 +506,38 @@ PYBIND11_MODULE(_bindings, m) {
                    py::arg("local_indices"), py::arg("remote_side"),
                    py::arg("remote_indices"), py::arg("notif_msg") = std::string(""),
                    py::arg("backend") = std::vector<uintptr_t>({}),
-                   py::arg("skip_desc_merg") = false)
+                   py::arg("skip_desc_merg") = false, py::arg("timeout_us") = 0,
+                   py::arg("priority") = NIXL_PRIO_NORMAL,
+                   py::arg("segments") = std::vector<int>(),
+                   py::arg("segment_notifs") = std::vector<std::string>(),
+                   py::arg("pack_local_staging") = 0,
+                   py::arg("pack_remote_staging") = 0,
+                   py::arg("pack_staging_len") = 0)
         .def("createXferReq", [](nixlAgent &agent,
                                  const nixl_xfer_op_t &operation,
                                  const nixl_xfer_dlist_t &local_descs,
                                  const nixl_xfer_dlist_t &remote_descs,
                                  const std::string &remote_agent,
                                  const std::string &notif_msg,
-                                 std::vector<uintptr_t> backends) -> uintptr_t {
+                                 std::vector<uintptr_t> backends,
+                                 uint64_t timeout_us,
+                                 nixl_xfer_prio_t priority,
+                                 std::vector<int> segments,
+                                 std::vector<std::string> segment_notifs,
+                                 uintptr_t pack_local_staging,
+                                 uintptr_t pack_remote_staging,
+                                 size_t pack_staging_len) -> uintptr_t {
                     nixlXferReqH* handle = nullptr;
                     nixl_opt_args_t extra_params;
 
+                    extra_params.timeoutUs         = timeout_us;
+                    extra_params.priority          = priority;
+                    extra_params.segments          = segments;
+                    extra_params.segmentNotifs     = segment_notifs;
+                    extra_params.packLocalStaging  = pack_local_staging;
+                    extra_params.packRemoteStaging = pack_remote_staging;
+                    extra_params.packStagingLen    = pack_staging_len;
+
                     for(uintptr_t backend: backends)
                         extra_params.backends.push_back((nixlBackendH*) backend);
 
@@ -414,25 +552,193 @@ PYBIND11_MODULE(_bindings, m) {
                 }, py::arg("operation"), py::arg("local_descs"),
                    py::arg("remote_descs"), py::arg("remote_agent"),
                    py::arg("notif_msg") = std::string(""),
-                   py::arg("backend") = std::vector<uintptr_t>({}))
-        .def("postXferReq", [](nixlAgent &agent, uintptr_t reqh, std::string notif_msg) -> nixl_status_t {
+                   py::arg("backend") = std::vector<uintptr_t>({}),
+                   py::arg("timeout_us") = 0, py::arg("priority") = NIXL_PRIO_NORMAL,
+                   py::arg("segments") = std::vector<int>(),
+                   py::arg("segment_notifs") = std::vector<std::string>(),
+                   py::arg("pack_local_staging") = 0,
+                   py::arg("pack_remote_staging") = 0,
+                   py::arg("pack_staging_len") = 0)
+        .def("makeBcastXferReq", [](nixlAgent &agent,
+                                    uintptr_t local_side,
+                                    std::vector<int> local_indices,
+                                    std::vector<uintptr_t> remote_sides,
+                                    std::vector<int> remote_indices,
+                                    const std::string &notif_msg,
+                                    std::vector<uintptr_t> backends,
+                                    uint64_t timeout_us,
+                                    nixl_xfer_prio_t priority) -> uintptr_t {
+                    nixlXferReqH* handle = nullptr;
+                    nixl_opt_args_t extra_params;
+                    std::vector<const nixlDlistH*> sides;
+
+                    extra_params.timeoutUs = timeout_us;
+                    extra_params.priority  = priority;
+
+                    for(uintptr_t backend: backends)
+                        extra_params.backends.push_back((nixlBackendH*) backend);
+                    for(uintptr_t side: remote_sides)
+                        sides.push_back((nixlDlistH*) side);
+
+                    if (notif_msg.size()>0) {
+                        extra_params.notifMsg = notif_msg;
+                        extra_params.hasNotif = true;
+                    }
+                    nixl_status_t ret = agent.makeBcastXferReq((nixlDlistH*) local_side, local_indices,
+                                                               sides, remote_indices,
+                                                               handle, &extra_params);
+
+                    throw_nixl_exception(ret);
+                    return (uintptr_t) handle;
+                }, py::arg("local_side"), py::arg("local_indices"),
+                   py::arg("remote_sides"), py::arg("remote_indices"),
+                   py::arg("notif_msg") = std::string(""),
+                   py::arg("backend") = std::vector<uintptr_t>({}),
+                   py::arg("timeout_us") = 0, py::arg("priority") = NIXL_PRIO_NORMAL)
+        .def("createBcastXferReq", [](nixlAgent &agent,
+                                      const nixl_xfer_dlist_t &local_descs,
+                                      const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                                      const std::vector<std::string> &remote_agents,
+                                      const std::string &notif_msg,
+                                      std::vector<uintptr_t> backends,
+                                      uint64_t timeout_us,
+                                      nixl_xfer_prio_t priority) -> uintptr_t {
+                    nixlXferReqH* handle = nullptr;
+                    nixl_opt_args_t extra_params;
+
+                    extra_params.timeoutUs = timeout_us;
+                    extra_params.priority  = priority;
+
+                    for(uintptr_t backend: backends)
+                        extra_params.backends.push_back((nixlBackendH*) backend);
+
+                    if (notif_msg.size()>0) {
+                        extra_params.notifMsg = notif_msg;
+                        extra_params.hasNotif = true;
+                    }
+                    nixl_status_t ret = agent.createBcastXferReq(local_descs, remote_descs, remote_agents,
+                                                                 handle, &extra_params);
+
+                    throw_nixl_exception(ret);
+                    return (uintptr_t) handle;
+                }, py::arg("local_descs"), py::arg("remote_descs"), py::arg("remote_agents"),
+                   py::arg("notif_msg") = std::string(""),
+                   py::arg("backend") = std::vector<uintptr_t>({}),
+                   py::arg("timeout_us") = 0, py::arg("priority") = NIXL_PRIO_NORMAL)
+        .def("makeGatherXferReq", [](nixlAgent &agent,
+                                     uintptr_t local_side,
+                                     std::vector<std::vector<int>> local_indices,
+                                     std::vector<uintptr_t> remote_sides,
+                                     std::vector<std::vector<int>> remote_indices,
+                                     const std::string &notif_msg,
+                                     std::vector<uintptr_t> backends,
+                                     uint64_t timeout_us,
+                                     nixl_xfer_prio_t priority) -> uintptr_t {
+                    nixlXferReqH* handle = nullptr;
+                    nixl_opt_args_t extra_params;
+                    std::vector<const nixlDlistH*> sides;
+
+                    extra_params.timeoutUs = timeout_us;
+                    extra_params.priority  = priority;
+
+                    for(uintptr_t backend: backends)
+                        extra_params.backends.push_back((nixlBackendH*) backend);
+                    for(uintptr_t side: remote_sides)
+                        sides.push_back((nixlDlistH*) side);
+
+                    if (notif_msg.size()>0) {
+                        extra_params.notifMsg = notif_msg;
+                        extra_params.hasNotif = true;
+                    }
+                    nixl_status_t ret = agent.makeGatherXferReq((nixlDlistH*) local_side, local_indices,
+                                                                sides, remote_indices,
+                                                                handle, &extra_params);
+
+                    throw_nixl_exception(ret);
+                    return (uintptr_t) handle;
+                }, py::arg("local_side"), py::arg("local_indices"),
+                   py::arg("remote_sides"), py::arg("remote_indices"),
+                   py::arg("notif_msg") = std::string(""),
+                   py::arg("backend") = std::vector<uintptr_t>({}),
+                   py::arg("timeout_us") = 0, py::arg("priority") = NIXL_PRIO_NORMAL)
+        .def("createGatherXferReq", [](nixlAgent &agent,
+                                       const std::vector<nixl_xfer_dlist_t> &local_descs,
+                                       const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                                       const std::vector<std::string> &remote_agents,
+                                       const std::string &notif_msg,
+                                       std::vector<uintptr_t> backends,
+                                       uint64_t timeout_us,
+                                       nixl_xfer_prio_t priority) -> uintptr_t {
+                    nixlXferReqH* handle = nullptr;
+                    nixl_opt_args_t extra_params;
+
+                    extra_params.timeoutUs = timeout_us;
+                    extra_params.priority  = priority;
+
+                    for(uintptr_t backend: backends)
+                        extra_params.backends.push_back((nixlBackendH*) backend);
+
+                    if (notif_msg.size()>0) {
+                        extra_params.notifMsg = notif_msg;
+                        extra_params.hasNotif = true;
+                    }
+                    nixl_status_t ret = agent.createGatherXferReq(local_descs, remote_descs, remote_agents,
+                                                                  handle, &extra_params);
+
+                    throw_nixl_exception(ret);
+                    return (uintptr_t) handle;
+                }, py::arg("local_descs"), py::arg("remote_descs"), py::arg("remote_agents"),
+                   py::arg("notif_msg") = std::string(""),
+                   py::arg("backend") = std::vector<uintptr_t>({}),
+                   py::arg("timeout_us") = 0, py::arg("priority") = NIXL_PRIO_NORMAL)
+        .def("postXferReq", [](nixlAgent &agent, uintptr_t reqh, std::string notif_msg,
+                               std::vector<uintptr_t> depends_on) -> nixl_status_t {
                     nixl_opt_args_t extra_params;
                     nixl_status_t ret;
+                    for (auto & dep : depends_on)
+                        extra_params.dependsOn.push_back((nixlXferReqH*) dep);
                     if (notif_msg.size()>0) {
                         extra_params.notifMsg = notif_msg;
                         extra_params.hasNotif = true;
+                    }
+                    if (notif_msg.size()>0 || depends_on.size()>0) {
                         ret = agent.postXferReq((nixlXferReqH*) reqh, &extra_params);
                     } else {
                         ret = agent.postXferReq((nixlXferReqH*) reqh);
                     }
                     throw_nixl_exception(ret);
                     return ret;
-                }, py::arg("reqh"), py::arg("notif_msg") = std::string(""))
+                }, py::arg("reqh"), py::arg("notif_msg") = std::string(""),
+                   py::arg("depends_on") = std::vector<uintptr_t>())
         .def("getXferStatus", [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
                     nixl_status_t ret = agent.getXferStatus((nixlXferReqH*) reqh);
                     throw_nixl_exception(ret);
                     return ret;
                 })
+        .def("getXferProgress", [](nixlAgent &agent, uintptr_t reqh) -> py::tuple {
+                    nixl_xfer_progress_t progress;
+                    nixl_status_t ret = agent.getXferProgress((nixlXferReqH*) reqh, progress);
+                    throw_nixl_exception(ret);
+                    return py::make_tuple(ret, progress.doneBytes, progress.totalBytes,
+                                          progress.segmentsDone);
+                })
+        .def("cancelXferReq", [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
+                    nixl_status_t ret = agent.cancelXferReq((nixlXferReqH*) reqh);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
+        .def("setPeerLimits", [](nixlAgent &agent, std::string remote_agent,
+                                 const nixl_xfer_limits_t &limits) -> nixl_status_t {
+                    nixl_status_t ret = agent.setPeerLimits(remote_agent, limits);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
+        .def("setBackendLimits", [](nixlAgent &agent, uintptr_t backend,
+                                    const nixl_xfer_limits_t &limits) -> nixl_status_t {
+                    nixl_status_t ret = agent.setBackendLimits((nixlBackendH*) backend, limits);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
         .def("queryXferBackend", [](nixlAgent &agent, uintptr_t reqh) -> uintptr_t {
                     nixlBackendH* backend = nullptr;
                     throw_nixl_exception(agent.queryXferBackend((nixlXferReqH*) reqh, backend));
@@ -443,11 +749,79 @@ PYBIND11_MODULE(_bindings, m) {
                     throw_nixl_exception(ret);
                     return ret;
                 })
+        .def("createXferStream", [](nixlAgent &agent, uintptr_t reqh) -> uintptr_t {
+                    nixlXferStreamH* stream = nullptr;
+                    throw_nixl_exception(agent.createXferStream((nixlXferReqH*) reqh, stream));
+                    return (uintptr_t) stream;
+                })
+        .def("postXferChunk", [](nixlAgent &agent, uintptr_t stream,
+                                 std::string notif_msg) -> nixl_status_t {
+                    nixl_status_t ret = agent.postXferChunk((nixlXferStreamH*) stream, notif_msg);
+                    throw_nixl_exception(ret);
+                    return ret;
+                }, py::arg("stream"), py::arg("notif_msg") = std::string(""))
+        .def("getXferStreamStatus", [](nixlAgent &agent, uintptr_t stream) -> nixl_status_t {
+                    nixl_status_t ret = agent.getXferStreamStatus((nixlXferStreamH*) stream);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
+        .def("releaseXferStream", [](nixlAgent &agent, uintptr_t stream) -> nixl_status_t {
+                    nixl_status_t ret = agent.releaseXferStream((nixlXferStreamH*) stream);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
         .def("releasedDlistH", [](nixlAgent &agent, uintptr_t handle) -> nixl_status_t {
                     nixl_status_t ret = agent.releasedDlistH((nixlDlistH*) handle);
                     throw_nixl_exception(ret);
                     return ret;
                 })
+        .def("getStats", [](nixlAgent &agent) -> py::dict {
+                    nixl_agent_stats_t stats;
+                    throw_nixl_exception(agent.getStats(stats));
+
+                    auto to_dict = [](const std::array<nixlXferStats, 2> &op_stats) {
+                        py::dict ops;
+                        for (int op = NIXL_READ; op <= NIXL_WRITE; ++op) {
+                            const nixlXferStats &st = op_stats[op];
+                            py::dict entry;
+                            entry["post_count"]        = st.postCount;
+                            entry["xfer_count"]        = st.xferCount;
+                            entry["error_count"]       = st.errorCount;
+                            entry["total_bytes"]       = st.totalBytes;
+                            entry["desc_count"]        = st.descCount;
+                            entry["posted_desc_count"] = st.postedDescCount;
+                            entry["total_ns"]          = st.totalNs;
+                            entry["max_ns"]            = st.maxNs;
+                            entry["p50_ns"]            = st.getPercentileNs(50);
+                            entry["p99_ns"]            = st.getPercentileNs(99);
+                            entry["latency_buckets"]   = st.latencyBuckets;
+                            ops[op == NIXL_READ ? "READ" : "WRITE"] = entry;
+                        }
+                        return ops;
+                    };
+
+                    py::dict peers, backends, ret;
+                    for (auto & elm : stats.peers)
+                        peers[py::str(elm.first)] = to_dict(elm.second);
+                    for (auto & elm : stats.backends)
+                        backends[py::str(elm.first)] = to_dict(elm.second);
+                    ret["peers"]            = peers;
+                    ret["backends"]         = backends;
+                    ret["backend_counters"] = stats.backendCounters;
+                    ret["notifs_sent"]      = stats.notifsSent;
+                    ret["notifs_received"]  = stats.notifsReceived;
+                    return ret;
+                })
+        .def("exportStats", [](nixlAgent &agent, nixl_stats_fmt_t format) -> std::string {
+                    std::string out;
+                    throw_nixl_exception(agent.exportStats(out, format));
+                    return out;
+                }, py::arg("format") = NIXL_STATS_PROMETHEUS)
+        .def("dumpTrace", [](nixlAgent &agent, const std::string &path) -> nixl_status_t {
+                    nixl_status_t ret = agent.dumpTrace(path);
+                    throw_nixl_exception(ret);
+                    return ret;
+                })
         .def("getNotifs", [](nixlAgent &agent,
                              nixl_py_notifs_t &notif_map,
                              std::vector<uintptr_t> backends) -> nixl_py_notifs_t {
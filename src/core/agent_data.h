@@ -17,8 +17,15 @@
 #ifndef __AGENT_DATA_H_
 #define __AGENT_DATA_H_
 
+#include <unordered_set>
 #include "common/str_tools.h"
 #include "mem_section.h"
+#include "xfer_cache.h"
+#include "mem_arena.h"
+#include "telemetry.h"
+#include "trace.h"
+#include "local_copy.h"
+#include "xfer_pack.h"
 
 typedef std::vector<nixlBackendEngine*> backend_list_t;
 
@@ -33,6 +40,7 @@ class nixlAgentData {
         // Bookkeeping from backend type and memory type to backend engine
         backend_list_t                         notifEngines;
         backend_map_t                          backendEngines;
+        backend_list_t                         idToEngine;
         std::array<backend_list_t, FILE_SEG+1> memToBackend;
 
         // Bookkeping for local connection metadata and user handles per backend
@@ -47,9 +55,160 @@ class nixlAgentData {
         std::unordered_map<std::string, nixlRemoteSection*,
                            std::hash<std::string>, strEqual>     remoteSections;
 
+        // Agent names are interned into dense ids, so the data path can check
+        // a remote is still loaded without hashing its name. Ids are not reused,
+        // and remoteById mirrors remoteSections with nullptr for removed ones.
+        std::unordered_map<std::string, unsigned int,
+                           std::hash<std::string>, strEqual>     agentIds;
+        std::vector<nixlRemoteSection*>                          remoteById;
+
+        // Optional memoization of createXferReq preparations, can be nullptr
+        nixlXferCache*                                           xferCache;
+
+        // Optional pool to split large descriptor list preparations
+        nixlThreadPool*                                          workerPool;
+        // Pool running the registerMemAsync tasks, created at the first one,
+        // and the requests not yet collected or released
+        nixlThreadPool*                                          regPool;
+        std::unordered_set<nixlRegReqH*>                         regReqs;
+
+        // Backend handles of canceled transfers the backend could not abort
+        // yet, retried on later posts and cancellations
+        std::vector<std::pair<nixlBackendEngine*,
+                              nixlBackendReqH*>>                 canceledReqs;
+
+        // allocMem arenas by base address, kept registered until destruction
+        std::map<uintptr_t, nixlMemArena*>                       arenas;
+
+        // Optional transfer counters, nullptr when telemetry is disabled
+        nixlTelemetry*                                           telemetry;
+        // Optional thread writing the stats to a file, can be nullptr
+        nixlStatsExporter*                                       exporter;
+        // Optional priority scheduling and limits of the transfers, can be
+        // nullptr till limits are set
+        nixlXferSched*                                           sched;
+        // Batches gathering small posts, when coalescing is enabled
+        std::vector<nixlXferBatch*>                              openBatches;
+        // Loopback DRAM copies done by the agent, when enabled, and the
+        // notifications of these copies till getNotifs reads them
+        nixlLocalCopier*                                         copier;
+        notif_list_t                                             localNotifs;
+        // Key of the packed transfers for this agent, empty when packing is
+        // disabled, and the keys of the remote agents that advertised one
+        std::string                                              packKey;
+        std::unordered_map<std::string, std::string>             packPeers;
+        // Packed posts waiting for the target to acknowledge their scatter
+        uint64_t                                                 packSeq;
+        nixl_pack_waits_t                                        packWaits;
+        // Notifications read while waiting for such acks, till getNotifs
+        std::unordered_map<nixlBackendEngine*, notif_list_t>     heldNotifs;
+
         nixlAgentData(const std::string &name, const nixlAgentConfig &cfg);
         ~nixlAgentData();
 
+        unsigned int getAgentId(const std::string &agent_name);
+        // Adds, or removes with nullptr, the remote section of an agent
+        void setRemoteSection(const std::string &agent_name,
+                              nixlRemoteSection* section);
+        // If the remote agent of a transfer, or of any of its peer parts
+        // for broadcasts and gathers, was invalidated
+        bool remoteRemoved(const nixlXferReqH* handle) const;
+        // Releases the backend handle of a transfer in progress, or keeps it
+        // in canceledReqs if the backend cannot abort it right away
+        void cancelBackendReq(nixlBackendEngine* engine,
+                              nixlBackendReqH* handle);
+        void retryCanceled();
+        // Adds descs to the local section for a backend, and for local
+        // operations to the self remote section as well
+        nixl_status_t addLocalDescs(const nixl_reg_dlist_t &descs,
+                                    nixlBackendEngine* backend,
+                                    const std::vector<nixlBackendMD*>* registered = nullptr);
+        // Points a new transfer request to its telemetry counters
+        void initXferStats(nixlXferReqH* handle, const int &user_descs);
+
+        // Sets the priority class of a new transfer request
+        void initXferPrio(nixlXferReqH* handle, const nixl_opt_args_t* extra_params);
+        // Creates the scheduler when first needed by limits or chained posts
+        void createSched();
+        // Attaches a transfer request to the scheduling, at its first post
+        void initXferSched(nixlXferReqH* handle);
+        // Posts a transfer to its backend, releasing its completed backend
+        // handle first if needed, and tracks it if it is in progress
+        nixl_status_t startXfer(nixlXferReqH* handle,
+                                const nixl_opt_b_args_t &opt_args,
+                                const bool &release_done);
+        // Starts the held posts that can be, polling the transfers in
+        // progress if some still have to wait. Fails the chained posts
+        // whose dependencies did not complete.
+        void dispatchHeld();
+
+        // Splits a transfer across the backends that can do it, leaves
+        // req_hndl as nullptr if it would not have at least two parts
+        nixl_status_t makeStripedReq(const nixl_xfer_op_t &operation,
+                                     const nixl_xfer_dlist_t &local_descs,
+                                     const nixl_xfer_dlist_t &remote_descs,
+                                     const std::string &remote_agent,
+                                     const nixl_opt_args_t* extra_params,
+                                     nixlXferReqH* &req_hndl);
+        // Splits a new transfer request into the segments of extra_params,
+        // viewing into its descriptors, which the parts are then prepared with
+        nixl_status_t makeSegments(nixlXferReqH* handle,
+                                   const nixl_opt_args_t* extra_params);
+        nixl_status_t prepSegments(nixlXferReqH* handle,
+                                   const nixl_opt_b_args_t &opt_args);
+        // Sets up a new transfer request over the requests to several peers
+        // in its parts, as made by makeXferReq without notification
+        nixl_status_t joinPeerParts(nixlXferReqH* handle,
+                                    const nixl_xfer_op_t &operation,
+                                    const nixl_opt_args_t* extra_params);
+        // Posts all the parts of a request, whichever their kind
+        nixl_status_t postParts(nixlXferReqH* handle);
+        // Combined status of the parts, a failed part gives up the others.
+        // On completion of stripes or segments, the agent sends the
+        // notification of the handle.
+        nixl_status_t partsStatus(nixlXferReqH* handle);
+        void cancelParts(nixlXferReqH* handle);
+        nixl_status_t releaseParts(nixlXferReqH* handle);
+        // Backend status of a transfer in progress, or gives up its backend
+        // handle, for both plain and multi-part transfers
+        nixl_status_t checkXfer(nixlXferReqH* handle);
+        void cancelXfer(nixlXferReqH* handle);
+        // Cancels a transfer in progress or held past its deadline, setting
+        // NIXL_ERR_TIMEOUT, and returns if it did
+        bool expireXfer(nixlXferReqH* handle, const nixlTime::us_t &now);
+
+        // Adds a post to the open batch of its peer if it can be coalesced,
+        // returning false if it has to be posted by itself
+        bool coalesceXfer(nixlXferReqH* handle, nixl_status_t &ret);
+        // Posts the batch with the descriptors of all its members
+        void postBatch(nixlXferBatch* batch);
+        void notifyBatch(nixlXferBatch* batch);
+        // Status of a batch, posting it when its window expired, and
+        // sending the notifications of its members on completion
+        nixl_status_t checkBatch(nixlXferBatch* batch);
+        // Posts the open batches whose window expired
+        void flushBatches();
+
+        // Makes a plain loopback DRAM transfer request a local copy
+        void initLocalCopy(nixlXferReqH* handle);
+        // Makes a new write request packed if it has staging buffers and
+        // small enough descriptors, its backend handle is then for the staging
+        nixl_status_t initPack(nixlXferReqH* handle,
+                               const nixl_opt_args_t* extra_params);
+        // Status of a packed write, which completes once the target
+        // acknowledged the scatter of its staging buffer
+        nixl_status_t checkPack(nixlXferReqH* handle);
+        // Scatters a packed transfer received by engine into its destinations,
+        // after checking they are registered, and acknowledges it to the
+        // initiator, leaving the user message in msg if it was scattered
+        nixl_status_t unpackXfer(nixlBackendEngine* engine,
+                                 const std::string &remote_agent,
+                                 nixl_blob_t &msg, bool &has_notif);
+        // Reads the notifications of engine into notif_list, processing the
+        // packed transfers and their acks
+        nixl_status_t pollNotifs(nixlBackendEngine* engine,
+                                 notif_list_t &notif_list);
+
     friend class nixlAgent;
 };
 
@@ -72,6 +231,7 @@ class nixlBackendH {
 
     friend class nixlAgentData;
     friend class nixlAgent;
+    friend class nixlXferCache;
 };
 
 #endif
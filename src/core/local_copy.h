@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __LOCAL_COPY_H_
+#define __LOCAL_COPY_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "backend/backend_aux.h"
+
+class nixlLocalCopier;
+
+// Copies of a loopback DRAM transfer, as pieces of at most the piece size of
+// the copier, so large descriptors are shared between its workers. The job is
+// built with its transfer request and reused by each post.
+class nixlCopyJob {
+    private:
+        struct piece_t {
+            void*       dst;
+            const void* src;
+            size_t      len;
+        };
+
+        nixlLocalCopier*     copier;
+        std::vector<piece_t> pieces;
+        uint64_t             totalBytes = 0;
+        // Pieces of the current post not copied yet
+        std::atomic<size_t>  remaining{0};
+
+    public:
+        nixlCopyJob(nixlLocalCopier* copier, const nixl_xfer_op_t &op,
+                    const nixl_meta_dview_t &initiator,
+                    const nixl_meta_dview_t &target);
+        // Drops what is left of a post in progress
+        ~nixlCopyJob();
+
+        inline bool done() const {
+            return remaining.load(std::memory_order_acquire) == 0;
+        }
+
+    friend class nixlLocalCopier;
+};
+
+// In process copies of the loopback DRAM transfers of an agent. Jobs below
+// asyncBytes are copied by the posting thread, larger ones are queued piece
+// by piece to the worker threads, which copy them with non-temporal stores
+// so the caches of the application are not evicted by the transfer.
+class nixlLocalCopier {
+    private:
+        size_t                  asyncBytes;
+        size_t                  pieceBytes;
+
+        std::vector<std::thread> workers;
+        std::mutex              lock;
+        std::condition_variable cv;
+        std::deque<std::pair<nixlCopyJob*, size_t>> queue;
+        bool                    stop = false;
+
+        void workerLoop();
+
+    public:
+        nixlLocalCopier(const size_t &num_threads, const size_t &async_bytes);
+        ~nixlLocalCopier();
+
+        nixlLocalCopier(const nixlLocalCopier&) = delete;
+        nixlLocalCopier& operator=(const nixlLocalCopier&) = delete;
+
+        // NIXL_SUCCESS if the copy was done right away, or NIXL_IN_PROG
+        // till the job is done
+        nixl_status_t post(nixlCopyJob* job);
+        // Drops the queued pieces of a job, and waits for the ones being copied
+        void cancel(nixlCopyJob* job);
+
+    friend class nixlCopyJob;
+};
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __MEM_ARENA_H_
+#define __MEM_ARENA_H_
+
+#include <set>
+#include <vector>
+#include <unordered_map>
+#include "nixl_types.h"
+#include "mem_section.h"
+
+// A DRAM arena for allocMem. It is mapped once, with huge pages when possible
+// and optionally bound to a NUMA node, and registered by the agent as a single
+// region, so the buffers handed out are covered by its registration. Buffers
+// are power of two blocks of a buddy allocator, to keep splitting and merging
+// cheap for mixed block sizes.
+class nixlMemArena {
+    private:
+        uintptr_t                                 base;
+        size_t                                    size;
+        int                                       numaNode;
+        bool                                      initErr;
+
+        unsigned int                              maxOrder;
+        // Free block offsets per order, and the order of allocated offsets
+        std::vector<std::set<size_t>>             freeBlocks;
+        std::unordered_map<size_t, unsigned int>  allocated;
+        size_t                                    usedBytes = 0;
+
+    public:
+        // Smallest block, and the arena granularity to be able to use 2MB pages
+        static constexpr unsigned int minOrder   = 12;
+        static constexpr unsigned int arenaOrder = 21;
+
+        // Backends the arena is registered with
+        backend_mask_t                            backends = 0;
+
+        // size is rounded up to a power of two, numa_node is -1 for no binding
+        nixlMemArena (const size_t &size, const int &numa_node);
+        ~nixlMemArena ();
+
+        bool getInitErr () const { return initErr; }
+        uintptr_t getAddr () const { return base; }
+        size_t getSize () const { return size; }
+        int getNumaNode () const { return numaNode; }
+        size_t getUsedBytes () const { return usedBytes; }
+
+        // Returns NIXL_ERR_NOT_FOUND if there is no free block large enough
+        nixl_status_t alloc (const size_t &len, uintptr_t &addr);
+        // Returns NIXL_ERR_NOT_FOUND if addr was not allocated from the arena
+        nixl_status_t free (const uintptr_t &addr);
+};
+
+#endif
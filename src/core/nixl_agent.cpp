@@ -16,6 +16,10 @@
  */
 
 #include <iostream>
+#include <algorithm>
+#include <memory>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "nixl.h"
 #include "serdes/serdes.h"
 #include "backend/backend_engine.h"
@@ -53,6 +57,8 @@ std::string nixlEnumStrings::statusStr (const nixl_status_t &status) {
         case NIXL_ERR_REPOST_ACTIVE: return "NIXL_ERR_REPOST_ACTIVE";
         case NIXL_ERR_UNKNOWN:       return "NIXL_ERR_UNKNOWN";
         case NIXL_ERR_NOT_SUPPORTED: return "NIXL_ERR_NOT_SUPPORTED";
+        case NIXL_ERR_TIMEOUT:       return "NIXL_ERR_TIMEOUT";
+        case NIXL_ERR_OVER_LIMIT:    return "NIXL_ERR_OVER_LIMIT";
         default:                     return "BAD_STATUS";
     }
 }
@@ -62,15 +68,87 @@ std::string nixlEnumStrings::statusStr (const nixl_status_t &status) {
 nixlAgentData::nixlAgentData(const std::string &name,
                              const nixlAgentConfig &cfg) :
                                    name(name), config(cfg) {
-        memorySection = new nixlLocalSection();
+        memorySection = new nixlLocalSection(cfg.regCacheSize,
+                                             cfg.coalesceRegs);
+
+        if (cfg.xferCacheSize > 0)
+            xferCache = new nixlXferCache(cfg.xferCacheSize);
+        else
+            xferCache = nullptr;
+
+        if (cfg.workerThreads > 1)
+            workerPool = new nixlThreadPool(cfg.workerThreads);
+        else
+            workerPool = nullptr;
+        regPool = nullptr;
+
+        if (cfg.enableTelemetry || !cfg.statsExportPath.empty())
+            telemetry = new nixlTelemetry();
+        else
+            telemetry = nullptr;
+
+        if (cfg.enableTracing)
+            nixlTrace::enable(cfg.traceRingSize);
+
+        if (!cfg.statsExportPath.empty())
+            exporter = new nixlStatsExporter(telemetry, name,
+                                             cfg.statsExportPath,
+                                             cfg.statsExportPeriodUs,
+                                             cfg.statsExportFormat);
+        else
+            exporter = nullptr;
+
+        if ((cfg.prioInflightBytes > 0) || hasXferLimits(cfg.peerLimits))
+            sched = new nixlXferSched(cfg.prioInflightBytes, cfg.peerLimits);
+        else
+            sched = nullptr;
+
+        if (cfg.localCopy)
+            copier = new nixlLocalCopier(cfg.localCopyThreads,
+                                         cfg.localCopyAsyncBytes);
+        else
+            copier = nullptr;
+
+        if (cfg.packXfers)
+            packKey = nixlXferPack::makeKey();
+        packSeq = 0;
 }
 
 nixlAgentData::~nixlAgentData() {
+    // Registration tasks still use the engines and their pool
+    for (auto & req : regReqs)
+        req->wait();
+    delete regPool;
+
+    // Stopped first, as it reads the counters of the engines
+    delete exporter;
+
+    // Cached handles only refer to the sections, so released first
+    delete xferCache;
     delete memorySection;
+    delete workerPool;
+    delete telemetry;
+    delete sched;
+    delete copier;
+
+    // Requests still in open batches are left as not coalesced
+    for (auto & batch : openBatches) {
+        for (auto & member : batch->members)
+            member->batch = nullptr;
+        delete batch;
+    }
+
+    // Unmapped after memorySection deregistered them
+    for (auto & elm: arenas)
+        delete elm.second;
 
     for (auto & elm: remoteSections)
         delete elm.second;
 
+    // Last attempt, engines are going away anyway
+    for (auto & elm: canceledReqs)
+        elm.first->releaseReqH(elm.second);
+
     for (auto & elm: backendEngines) {
         auto& plugin_manager = nixlPluginManager::getInstance();
         auto plugin_handle = plugin_manager.getPlugin(elm.second->getType());
@@ -86,6 +164,1002 @@ nixlAgentData::~nixlAgentData() {
 }
 
 
+unsigned int nixlAgentData::getAgentId(const std::string &agent_name) {
+    auto it = agentIds.find(agent_name);
+    if (it != agentIds.end())
+        return it->second;
+
+    unsigned int id = remoteById.size();
+    agentIds[agent_name] = id;
+    remoteById.push_back(nullptr);
+    return id;
+}
+
+void nixlAgentData::cancelBackendReq(nixlBackendEngine* engine,
+                                     nixlBackendReqH* handle) {
+    if (engine->releaseReqH(handle) != NIXL_SUCCESS)
+        canceledReqs.push_back({engine, handle});
+}
+
+void nixlAgentData::retryCanceled() {
+    auto it = canceledReqs.begin();
+    while (it != canceledReqs.end()) {
+        if (it->first->releaseReqH(it->second) == NIXL_SUCCESS)
+            it = canceledReqs.erase(it);
+        else
+            ++it;
+    }
+}
+
+void nixlAgentData::setRemoteSection(const std::string &agent_name,
+                                     nixlRemoteSection* section) {
+    if (section)
+        remoteSections[agent_name] = section;
+    else
+        remoteSections.erase(agent_name);
+    remoteById[getAgentId(agent_name)] = section;
+}
+
+bool nixlAgentData::remoteRemoved(const nixlXferReqH* handle) const {
+    if (!remoteById[handle->remoteId])
+        return true;
+    for (auto & part : handle->peerParts)
+        if (!remoteById[part->remoteId])
+            return true;
+    return false;
+}
+
+void nixlAgentData::initXferStats(nixlXferReqH* handle, const int &user_descs) {
+    handle->peerStats     = telemetry->getPeer(handle->remoteId,
+                                               handle->remoteAgent,
+                                               handle->backendOp);
+    handle->userDescCount = user_descs;
+
+    if (!handle->hasParts()) {
+        handle->backendStats = telemetry->getBackend(handle->engine,
+                                                     handle->backendOp);
+        for (int i = 0; i < handle->initiatorView.descCount(); ++i)
+            handle->totalBytes += handle->initiatorView[i].len;
+        return;
+    }
+
+    // Each part counts towards its backend, and the handle towards the peer
+    for (auto & part : handle->parts()) {
+        part->backendStats  = telemetry->getBackend(part->engine,
+                                                    part->backendOp);
+        part->userDescCount = part->initiatorView.descCount();
+        for (int i = 0; i < part->initiatorView.descCount(); ++i)
+            part->totalBytes += part->initiatorView[i].len;
+        handle->totalBytes += part->totalBytes;
+    }
+}
+
+void nixlAgentData::initXferPrio(nixlXferReqH* handle,
+                                 const nixl_opt_args_t* extra_params) {
+    handle->priority = extra_params ? extra_params->priority : NIXL_PRIO_NORMAL;
+}
+
+void nixlAgentData::createSched() {
+    if (!sched)
+        sched = new nixlXferSched(config.prioInflightBytes, config.peerLimits);
+}
+
+void nixlAgentData::initXferSched(nixlXferReqH* handle) {
+    handle->sched = sched;
+
+    // Telemetry already summed the bytes of the request
+    if (telemetry)
+        return;
+
+    for (int i = 0; i < handle->initiatorView.descCount(); ++i)
+        handle->totalBytes += handle->initiatorView[i].len;
+    for (auto & part : handle->parts()) {
+        for (int i = 0; i < part->initiatorView.descCount(); ++i)
+            part->totalBytes += part->initiatorView[i].len;
+        handle->totalBytes += part->totalBytes;
+    }
+}
+
+nixl_status_t nixlAgentData::startXfer(nixlXferReqH* handle,
+                                       const nixl_opt_b_args_t &opt_args,
+                                       const bool &release_done) {
+    nixl_status_t ret;
+
+    // We CAN repost a previous request that is completed
+    if (release_done && !handle->copyJob)
+        handle->engine->releaseReqH(handle->backendHandle);
+    if (handle->batch)
+        handle->leaveBatch();
+
+    // Tracked till recordDone, which might be right after the post
+    if (handle->sched)
+        handle->sched->addInflight(handle);
+
+    if (handle->hasParts()) {
+        // The agent sends the notification itself, once all parts completed
+        NIXL_TRACE_SCOPE("backend.postXfer", "nixl", handle->postedDescCount());
+        ret = postParts(handle);
+    } else if (handle->copyJob) {
+        NIXL_TRACE_SCOPE("localCopy", "nixl", handle->initiatorView.descCount());
+        ret = copier->post(handle->copyJob);
+        if (handle->hasNotif) {
+            if (telemetry)
+                telemetry->addNotifsSent(1);
+            if (ret == NIXL_SUCCESS)
+                localNotifs.emplace_back(name, handle->notifMsg);
+        }
+    } else if (handle->pack) {
+        // The layout always goes with the staging, for the target to scatter it
+        nixl_opt_b_args_t pack_args = opt_args;
+        NIXL_TRACE_SCOPE("backend.postXfer", "nixl",
+                         handle->initiatorView.descCount());
+
+        handle->pack->gather(handle->initiatorView);
+        pack_args.notifMsg = handle->pack->post(++packSeq, opt_args.hasNotif,
+                                                opt_args.notifMsg);
+        pack_args.hasNotif = true;
+        ret = handle->engine->postXfer (NIXL_WRITE,
+                                        handle->pack->localStaging,
+                                        handle->pack->remoteStaging,
+                                        handle->remoteAgent,
+                                        handle->backendHandle,
+                                        &pack_args);
+        // Only completed once the target acknowledged it
+        if (ret == NIXL_SUCCESS) {
+            handle->pack->sent = true;
+            ret = checkPack(handle);
+        } else if (ret < 0) {
+            handle->pack->drop();
+        }
+        if (telemetry && opt_args.hasNotif && (ret >= 0))
+            telemetry->addNotifsSent(1);
+    } else if (coalesceXfer(handle, ret)) {
+        // Posted with the other members of its batch, maybe later
+    } else {
+        NIXL_TRACE_SCOPE("backend.postXfer", "nixl",
+                         handle->initiatorView.descCount());
+        ret = handle->engine->postXfer (handle->backendOp,
+                                        handle->initiatorView,
+                                        handle->targetView,
+                                        handle->remoteAgent,
+                                        handle->backendHandle,
+                                        &opt_args);
+        if (telemetry && opt_args.hasNotif && (ret >= 0))
+            telemetry->addNotifsSent(1);
+    }
+    handle->status = ret;
+    handle->recordDone(ret);
+    return ret;
+}
+
+void nixlAgentData::dispatchHeld() {
+    std::vector<nixlXferLimiter*> blocked;
+    bool                          low_blocked;
+    nixlTime::us_t                now = nixlTime::getUs();
+
+    for (int pass = 0; (pass < 2) && sched->hasHeld(); ++pass) {
+        // Completions are only observed by polling, and the user might
+        // only be polling held requests. Deadlines are enforced meanwhile,
+        // also for the transfers the user does not poll.
+        if (pass > 0) {
+            auto it = sched->inflight.begin();
+            while (it != sched->inflight.end()) {
+                nixlXferReqH* req = *(it++); // Removed once done
+                req->status = checkXfer(req);
+                expireXfer(req, now);
+                req->recordDone(req->status);
+            }
+        }
+
+        // Held posts of different peers, backends or priorities do not
+        // wait behind each other
+        blocked.clear();
+        low_blocked = false;
+
+        auto it = sched->held.begin();
+        while (it != sched->held.end()) {
+            nixlXferReqH* handle = *(it++); // Removed once started
+
+            if (handle->depFailed) {
+                sched->unhold(handle);
+                if (handle->heldRelease) {
+                    handle->engine->releaseReqH(handle->backendHandle);
+                    handle->backendHandle = nullptr;
+                }
+                // Its own dependents are released as failed, behind it
+                handle->status = NIXL_ERR_NOT_POSTED;
+                handle->recordDone(NIXL_ERR_NOT_POSTED);
+                continue;
+            }
+
+            // Held past its deadline, it is never started
+            if (expireXfer(handle, now)) {
+                if (handle->heldRelease) {
+                    handle->engine->releaseReqH(handle->backendHandle);
+                    handle->backendHandle = nullptr;
+                }
+                handle->recordDone(handle->status);
+                continue;
+            }
+
+            if (!sched->canStartHeld(handle, blocked, low_blocked))
+                continue;
+
+            nixl_opt_b_args_t opt_args;
+            opt_args.notifMsg = handle->notifMsg;
+            opt_args.hasNotif = handle->hasNotif;
+            opt_args.priority = handle->priority;
+
+            sched->unhold(handle);
+            startXfer(handle, opt_args, handle->heldRelease);
+        }
+    }
+}
+
+nixl_status_t nixlAgentData::makeStripedReq(const nixl_xfer_op_t &operation,
+                                            const nixl_xfer_dlist_t &local_descs,
+                                            const nixl_xfer_dlist_t &remote_descs,
+                                            const std::string &remote_agent,
+                                            const nixl_opt_args_t* extra_params,
+                                            nixlXferReqH* &req_hndl) {
+    nixl_status_t                   ret;
+    nixl_opt_b_args_t               opt_args;
+    backend_mask_t                  backend_mask = 0;
+    nixlRemoteSection*              remote = remoteSections[remote_agent];
+    std::vector<nixlBackendEngine*> engines;
+    std::vector<nixl_meta_dlist_t>  local_metas, remote_metas;
+    std::vector<nixlXferReqH*>      stripes;
+
+    req_hndl = nullptr;
+    if (extra_params)
+        opt_args.priority = extra_params->priority;
+
+    if (!extra_params || extra_params->backends.size() == 0) {
+        backend_mask = memorySection->queryBackends(local_descs.getType()) &
+                       remote->queryBackends(remote_descs.getType());
+    } else {
+        for (auto & elm : extra_params->backends)
+            backend_mask |= backendBit(elm->engine);
+    }
+
+    // Nothing to stripe across with less than two backends
+    if (!(backend_mask & (backend_mask - 1)))
+        return NIXL_SUCCESS;
+
+    // Any part can go to any backend, so each has to cover all descriptors
+    while (backend_mask) {
+        nixlBackendEngine* backend = idToEngine[popBackend(backend_mask)];
+        nixl_meta_dlist_t  local_meta(local_descs.getType(),
+                                      local_descs.isSorted());
+        nixl_meta_dlist_t  remote_meta(remote_descs.getType(),
+                                       remote_descs.isSorted());
+
+        if ((memorySection->populate(local_descs, backend,
+                                     local_meta) != NIXL_SUCCESS) ||
+            (remote->populate(remote_descs, backend,
+                              remote_meta) != NIXL_SUCCESS))
+            continue;
+
+        engines.push_back(backend);
+        local_metas.push_back(std::move(local_meta));
+        remote_metas.push_back(std::move(remote_meta));
+    }
+
+    if (engines.size() < 2)
+        return NIXL_SUCCESS;
+
+    for (auto & backend : engines) {
+        nixlXferReqH* stripe   = new nixlXferReqH;
+        stripe->engine         = backend;
+        stripe->initiatorDescs = new nixl_meta_dlist_t(local_descs.getType());
+        stripe->targetDescs    = new nixl_meta_dlist_t(remote_descs.getType());
+        stripe->remoteAgent    = remote_agent;
+        stripe->remoteId       = getAgentId(remote_agent);
+        stripe->backendOp      = operation;
+        stripe->status         = NIXL_ERR_NOT_POSTED;
+        stripes.push_back(stripe);
+    }
+
+    // Contiguous shares of about the same number of bytes per backend, where
+    // descriptors are only cut at multiples of the chunk size from their start
+    size_t total  = 0;
+    size_t chunk  = config.stripeChunkSize;
+    size_t filled = 0;
+    size_t k      = 0;
+
+    for (auto & elm : local_descs)
+        total += elm.len;
+    size_t share = (total + engines.size() - 1) / engines.size();
+
+    for (int i = 0; i < local_descs.descCount(); ++i) {
+        size_t len    = local_descs[i].len;
+        size_t offset = 0;
+
+        while (offset < len) {
+            size_t part = len - offset;
+            bool   last = (k + 1 == engines.size());
+
+            if (!last && chunk && (part > share - filled)) {
+                size_t cut = ((offset + share - filled + chunk - 1) / chunk) * chunk;
+                part = std::min(part, cut - offset);
+            }
+
+            nixlMetaDesc local_part  = local_metas[k][i];
+            nixlMetaDesc remote_part = remote_metas[k][i];
+            local_part.addr  += offset;
+            local_part.len    = part;
+            remote_part.addr += offset;
+            remote_part.len   = part;
+            stripes[k]->initiatorDescs->addDesc(local_part);
+            stripes[k]->targetDescs->addDesc(remote_part);
+
+            offset += part;
+            filled += part;
+            if (!last && (filled >= share)) {
+                ++k;
+                filled = 0;
+            }
+        }
+    }
+
+    // Shares are filled in order, so only the last backends can be left out
+    while (!stripes.empty() && stripes.back()->initiatorDescs->isEmpty()) {
+        delete stripes.back();
+        stripes.pop_back();
+    }
+
+    if (stripes.size() < 2) {
+        for (auto & stripe : stripes)
+            delete stripe;
+        return NIXL_SUCCESS;
+    }
+
+    nixlXferReqH* handle = new nixlXferReqH;
+    handle->stripes      = std::move(stripes);
+
+    // The parts don't notify, the agent does once all of them completed
+    for (auto & stripe : handle->stripes) {
+        stripe->initiatorView = *stripe->initiatorDescs;
+        stripe->targetView    = *stripe->targetDescs;
+
+        NIXL_TRACE_SCOPE("backend.prepXfer", "nixl",
+                         stripe->initiatorView.descCount());
+        ret = stripe->engine->prepXfer(stripe->backendOp,
+                                       stripe->initiatorView,
+                                       stripe->targetView,
+                                       stripe->remoteAgent,
+                                       stripe->backendHandle,
+                                       &opt_args);
+        if (ret != NIXL_SUCCESS) {
+            delete handle;
+            return ret;
+        }
+
+        if (!handle->engine && stripe->engine->supportsNotif())
+            handle->engine = stripe->engine;
+    }
+
+    if (!handle->engine)
+        handle->engine = handle->stripes[0]->engine;
+
+    if (extra_params && extra_params->hasNotif) {
+        if (!handle->engine->supportsNotif()) {
+            delete handle;
+            return NIXL_ERR_BACKEND;
+        }
+        handle->notifMsg = extra_params->notifMsg;
+        handle->hasNotif = true;
+    }
+
+    handle->remoteAgent = remote_agent;
+    handle->remoteId    = getAgentId(remote_agent);
+    handle->backendOp   = operation;
+    handle->status      = NIXL_ERR_NOT_POSTED;
+    handle->timeout     = extra_params ? extra_params->timeoutUs : 0;
+
+    if (telemetry)
+        initXferStats(handle, local_descs.descCount());
+    initXferPrio(handle, extra_params);
+
+    req_hndl = handle;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlAgentData::makeSegments(nixlXferReqH* handle,
+                                          const nixl_opt_args_t* extra_params) {
+    const std::vector<int>         &segments = extra_params->segments;
+    const std::vector<nixl_blob_t> &notifs   = extra_params->segmentNotifs;
+    int                             start    = 0;
+
+    if (!notifs.empty() && (notifs.size() != segments.size()))
+        return NIXL_ERR_INVALID_PARAM;
+
+    for (auto & count : segments) {
+        if (count <= 0)
+            return NIXL_ERR_INVALID_PARAM;
+        start += count;
+    }
+    if (start != handle->initiatorView.descCount())
+        return NIXL_ERR_INVALID_PARAM;
+
+    for (auto & msg : notifs)
+        if (!msg.empty() && !handle->engine->supportsNotif())
+            return NIXL_ERR_BACKEND;
+
+    start = 0;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        nixlXferReqH* part  = new nixlXferReqH;
+        part->engine        = handle->engine;
+        part->initiatorView = handle->initiatorView.subView(start, segments[i]);
+        part->targetView    = handle->targetView.subView(start, segments[i]);
+        part->remoteAgent   = handle->remoteAgent;
+        part->remoteId      = handle->remoteId;
+        part->backendOp     = handle->backendOp;
+        part->status        = NIXL_ERR_NOT_POSTED;
+        if (!notifs.empty() && !notifs[i].empty()) {
+            part->notifMsg  = notifs[i];
+            part->hasNotif  = true;
+        }
+        handle->segments.push_back(part);
+        start += segments[i];
+    }
+
+    // The descriptors are still owned or kept alive by the handle
+    handle->initiatorView = nixl_meta_dview_t(handle->initiatorView.getType());
+    handle->targetView    = nixl_meta_dview_t(handle->targetView.getType());
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlAgentData::prepSegments(nixlXferReqH* handle,
+                                          const nixl_opt_b_args_t &opt_args) {
+    nixl_status_t     ret;
+    nixl_opt_b_args_t part_args;
+    part_args.priority = opt_args.priority;
+
+    for (auto & part : handle->segments) {
+        part_args.notifMsg = part->notifMsg;
+        part_args.hasNotif = part->hasNotif;
+
+        NIXL_TRACE_SCOPE("backend.prepXfer", "nixl",
+                         part->initiatorView.descCount());
+        ret = part->engine->prepXfer(part->backendOp,
+                                     part->initiatorView,
+                                     part->targetView,
+                                     part->remoteAgent,
+                                     part->backendHandle,
+                                     &part_args);
+        if (ret != NIXL_SUCCESS)
+            return ret;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlAgentData::joinPeerParts(nixlXferReqH* handle,
+                                           const nixl_xfer_op_t &operation,
+                                           const nixl_opt_args_t* extra_params) {
+    bool has_notif = extra_params && extra_params->hasNotif;
+
+    for (auto & part : handle->peerParts)
+        if (has_notif && !part->engine->supportsNotif())
+            return NIXL_ERR_BACKEND;
+
+    nixlXferReqH* first = handle->peerParts.front();
+
+    handle->engine      = first->engine;
+    handle->remoteAgent = first->remoteAgent;
+    handle->remoteId    = first->remoteId;
+    handle->backendOp   = operation;
+    handle->status      = NIXL_ERR_NOT_POSTED;
+    handle->timeout     = extra_params ? extra_params->timeoutUs : 0;
+    if (has_notif) {
+        handle->notifMsg = extra_params->notifMsg;
+        handle->hasNotif = true;
+    }
+
+    // The parts count towards their own peers, the handle is only scheduled
+    if (telemetry)
+        for (auto & part : handle->peerParts)
+            handle->totalBytes += part->totalBytes;
+    initXferPrio(handle, extra_params);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlAgentData::postParts(nixlXferReqH* handle) {
+    nixl_opt_b_args_t opt_args;
+    bool              peer_parts = !handle->peerParts.empty();
+    opt_args.priority = handle->priority;
+
+    for (auto & part : handle->parts()) {
+        // Same as postXferReq, a completed part is released before repost
+        if (part->status == NIXL_SUCCESS && part->backendHandle)
+            part->engine->releaseReqH(part->backendHandle);
+
+        part->postTime = handle->postTime;
+        if (part->peerStats)
+            part->peerStats->addPost();
+        if (part->backendStats)
+            part->backendStats->addPost();
+
+        // Only segments have their own notifications, and the parts of a
+        // broadcast or gather notify their own peer
+        if (peer_parts) {
+            opt_args.notifMsg = handle->notifMsg;
+            opt_args.hasNotif = handle->hasNotif;
+        } else {
+            opt_args.notifMsg = part->notifMsg;
+            opt_args.hasNotif = part->hasNotif;
+        }
+
+        part->status = part->engine->postXfer(part->backendOp,
+                                              part->initiatorView,
+                                              part->targetView,
+                                              part->remoteAgent,
+                                              part->backendHandle,
+                                              &opt_args);
+        part->recordDone(part->status);
+        if (part->status < 0)
+            break;
+        if (telemetry && opt_args.hasNotif)
+            telemetry->addNotifsSent(1);
+    }
+
+    return partsStatus(handle);
+}
+
+nixl_status_t nixlAgentData::partsStatus(nixlXferReqH* handle) {
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    for (auto & part : handle->parts()) {
+        if ((part->status < 0) && (ret >= 0))
+            ret = part->status;
+        else if ((part->status == NIXL_IN_PROG) && (ret == NIXL_SUCCESS))
+            ret = NIXL_IN_PROG;
+    }
+
+    // The other parts are given up, so the request can only be released
+    if (ret < 0) {
+        cancelParts(handle);
+        handle->canceled = true;
+        return ret;
+    }
+
+    if ((ret == NIXL_SUCCESS) && handle->hasNotif && handle->peerParts.empty()) {
+        ret = handle->engine->genNotif(handle->remoteAgent, handle->notifMsg);
+        if (telemetry && (ret == NIXL_SUCCESS))
+            telemetry->addNotifsSent(1);
+    }
+    return ret;
+}
+
+void nixlAgentData::cancelParts(nixlXferReqH* handle) {
+    for (auto & part : handle->parts()) {
+        if (part->status != NIXL_IN_PROG)
+            continue;
+        cancelBackendReq(part->engine, part->backendHandle);
+        part->backendHandle = nullptr;
+        part->status        = NIXL_ERR_NOT_POSTED;
+        part->recordDone(NIXL_ERR_NOT_POSTED);
+    }
+}
+
+nixl_status_t nixlAgentData::releaseParts(nixlXferReqH* handle) {
+    for (auto & part : handle->parts()) {
+        if (part->status != NIXL_IN_PROG)
+            continue;
+        if (part->engine->releaseReqH(part->backendHandle) < 0)
+            return NIXL_ERR_REPOST_ACTIVE;
+        part->backendHandle = nullptr;
+        part->status        = NIXL_ERR_NOT_POSTED;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlAgentData::checkXfer(nixlXferReqH* handle) {
+    if (handle->held)
+        return NIXL_IN_PROG;
+
+    if (handle->batch)
+        return checkBatch(handle->batch);
+
+    // Only a copy in progress can complete or queue the notification
+    if (handle->copyJob) {
+        if ((handle->status != NIXL_IN_PROG) || !handle->copyJob->done())
+            return handle->status;
+        if (handle->hasNotif)
+            localNotifs.emplace_back(name, handle->notifMsg);
+        return NIXL_SUCCESS;
+    }
+
+    if (handle->pack)
+        return checkPack(handle);
+
+    if (!handle->hasParts())
+        return handle->engine->checkXfer(handle->backendHandle);
+
+    // Only a post in progress can complete or send the notification
+    if (handle->status != NIXL_IN_PROG)
+        return handle->status;
+
+    for (auto & part : handle->parts()) {
+        if (part->status != NIXL_IN_PROG)
+            continue;
+        part->status = part->engine->checkXfer(part->backendHandle);
+        part->recordDone(part->status);
+    }
+    return partsStatus(handle);
+}
+
+void nixlAgentData::cancelXfer(nixlXferReqH* handle) {
+    // Nothing was given to the backends yet
+    if (handle->held) {
+        sched->unhold(handle);
+        return;
+    }
+
+    if (handle->hasParts()) {
+        cancelParts(handle);
+        return;
+    }
+
+    if (handle->copyJob) {
+        copier->cancel(handle->copyJob);
+        return;
+    }
+
+    // A late ack of the target is ignored
+    if (handle->pack)
+        handle->pack->drop();
+
+    // The merged transfer is aborted only if no other request is part of it
+    if (handle->batch) {
+        nixlXferBatch* batch = handle->batch;
+        if (!batch->open && (batch->members.size() == 1)) {
+            cancelBackendReq(batch->engine, batch->backendHandle);
+            batch->backendHandle = nullptr;
+        }
+        handle->leaveBatch();
+        return;
+    }
+
+    cancelBackendReq(handle->engine, handle->backendHandle);
+    handle->backendHandle = nullptr;
+}
+
+bool nixlAgentData::expireXfer(nixlXferReqH* handle, const nixlTime::us_t &now) {
+    if ((handle->status != NIXL_IN_PROG) || !handle->deadline ||
+        (now < handle->deadline))
+        return false;
+
+    cancelXfer(handle);
+    handle->canceled = true;
+    handle->status   = NIXL_ERR_TIMEOUT;
+    return true;
+}
+
+bool nixlAgentData::coalesceXfer(nixlXferReqH* handle, nixl_status_t &ret) {
+    nixlXferBatch* batch = nullptr;
+    size_t         bytes = 0;
+
+    if ((config.coalesceMaxReqs < 2) || handle->timeout ||
+        (handle->priority == NIXL_PRIO_HIGH))
+        return false;
+
+    for (int i = 0; i < handle->initiatorView.descCount(); ++i) {
+        bytes += handle->initiatorView[i].len;
+        if (bytes > config.coalesceMaxBytes)
+            return false;
+    }
+
+    for (auto & open : openBatches) {
+        if (open->matches(handle)) {
+            batch = open;
+            break;
+        }
+    }
+
+    if (!batch) {
+        batch = new nixlXferBatch(handle);
+        openBatches.push_back(batch);
+    }
+
+    batch->members.push_back(handle);
+    handle->batch = batch;
+
+    if (batch->members.size() >= config.coalesceMaxReqs) {
+        openBatches.erase(std::find(openBatches.begin(), openBatches.end(), batch));
+        postBatch(batch);
+    }
+
+    ret = batch->status;
+    return true;
+}
+
+void nixlAgentData::postBatch(nixlXferBatch* batch) {
+    nixl_opt_b_args_t opt_args;
+    opt_args.priority = batch->priority;
+    batch->open       = false;
+
+    // The remote might have been invalidated while the batch was open
+    if (!remoteById[batch->remoteId]) {
+        batch->status = NIXL_ERR_NOT_FOUND;
+        return;
+    }
+
+    for (auto & member : batch->members) {
+        for (int i = 0; i < member->initiatorView.descCount(); ++i) {
+            batch->initiatorDescs.addDesc(member->initiatorView[i]);
+            batch->targetDescs.addDesc(member->targetView[i]);
+        }
+    }
+
+    NIXL_TRACE_SCOPE("backend.postXfer", "nixl", batch->initiatorDescs.descCount());
+    batch->status = batch->engine->postXfer(batch->backendOp,
+                                            batch->initiatorDescs,
+                                            batch->targetDescs,
+                                            batch->remoteAgent,
+                                            batch->backendHandle,
+                                            &opt_args);
+    if (batch->status == NIXL_SUCCESS)
+        notifyBatch(batch);
+}
+
+void nixlAgentData::notifyBatch(nixlXferBatch* batch) {
+    // In order of post, the merged transfer was flushed as a whole
+    for (auto & member : batch->members) {
+        if (!member->hasNotif)
+            continue;
+        nixl_status_t ret = batch->engine->genNotif(batch->remoteAgent,
+                                                    member->notifMsg);
+        if (ret < 0)
+            batch->status = ret;
+        else if (telemetry)
+            telemetry->addNotifsSent(1);
+    }
+}
+
+nixl_status_t nixlAgentData::checkBatch(nixlXferBatch* batch) {
+    if (batch->open) {
+        if (nixlTime::getUs() - batch->openTime < config.coalesceWindowUs)
+            return NIXL_IN_PROG;
+
+        openBatches.erase(std::find(openBatches.begin(), openBatches.end(), batch));
+        postBatch(batch);
+        return batch->status;
+    }
+
+    if (batch->status != NIXL_IN_PROG)
+        return batch->status;
+
+    batch->status = batch->engine->checkXfer(batch->backendHandle);
+    if (batch->status == NIXL_SUCCESS)
+        notifyBatch(batch);
+    return batch->status;
+}
+
+void nixlAgentData::flushBatches() {
+    nixlTime::us_t now = nixlTime::getUs();
+
+    auto it = openBatches.begin();
+    while (it != openBatches.end()) {
+        nixlXferBatch* batch = *it;
+        if (batch->members.empty()) {
+            it = openBatches.erase(it);
+            delete batch;
+        } else if (now - batch->openTime >= config.coalesceWindowUs) {
+            it = openBatches.erase(it);
+            postBatch(batch);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void nixlAgentData::initLocalCopy(nixlXferReqH* handle) {
+    if (!copier || !handle->segments.empty() || (handle->remoteAgent != name) ||
+        (handle->initiatorView.getType() != DRAM_SEG) ||
+        (handle->targetView.getType() != DRAM_SEG))
+        return;
+
+    handle->copyJob = new nixlCopyJob(copier, handle->backendOp,
+                                      handle->initiatorView, handle->targetView);
+}
+
+nixl_status_t nixlAgentData::initPack(nixlXferReqH* handle,
+                                      const nixl_opt_args_t* extra_params) {
+    nixl_opt_b_args_t opt_args;
+    nixl_status_t     ret;
+    uint64_t          total = 0;
+    int               count = handle->initiatorView.descCount();
+
+    if (!config.packXfers || !extra_params || !extra_params->packStagingLen ||
+        (handle->backendOp != NIXL_WRITE) || !handle->segments.empty() ||
+        handle->copyJob || (count < 2) || !handle->engine->supportsNotif() ||
+        (handle->initiatorView.getType() != DRAM_SEG) ||
+        (handle->targetView.getType() != DRAM_SEG))
+        return NIXL_SUCCESS;
+
+    // Only a target that advertised packing scatters the staging
+    const std::string* remote_key = &packKey;
+    if (handle->remoteAgent != name) {
+        auto peer = packPeers.find(handle->remoteAgent);
+        if (peer == packPeers.end())
+            return NIXL_SUCCESS;
+        remote_key = &peer->second;
+    }
+
+    // Sent directly if the descriptors are large enough, or do not fit
+    for (int i = 0; i < count; ++i)
+        total += handle->initiatorView[i].len;
+    if ((total > extra_params->packStagingLen) ||
+        (total > config.packMaxDescSize * count))
+        return NIXL_SUCCESS;
+
+    nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    local.addDesc(nixlBasicDesc(extra_params->packLocalStaging, total, 0));
+    remote.addDesc(nixlBasicDesc(extra_params->packRemoteStaging, total, 0));
+
+    nixlXferPack* pack = new nixlXferPack(handle->targetView,
+                                          extra_params->packRemoteStaging,
+                                          *remote_key, packKey, packWaits);
+    if ((memorySection->populate(local, handle->engine,
+                                 pack->localStaging) != NIXL_SUCCESS) ||
+        (remoteById[handle->remoteId]->populate(remote, handle->engine,
+                                                pack->remoteStaging) != NIXL_SUCCESS)) {
+        delete pack;
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    // The backend handle is prepared for the staging buffers instead
+    if (handle->backendHandle) {
+        handle->engine->releaseReqH(handle->backendHandle);
+        handle->backendHandle = nullptr;
+    }
+
+    opt_args.notifMsg = pack->layout;
+    opt_args.hasNotif = true;
+    opt_args.priority = handle->priority;
+
+    NIXL_TRACE_SCOPE("backend.prepXfer", "nixl", 1);
+    ret = handle->engine->prepXfer (NIXL_WRITE,
+                                    pack->localStaging,
+                                    pack->remoteStaging,
+                                    handle->remoteAgent,
+                                    handle->backendHandle,
+                                    &opt_args);
+    if (ret != NIXL_SUCCESS) {
+        delete pack;
+        return ret;
+    }
+
+    handle->pack = pack;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlAgentData::checkPack(nixlXferReqH* handle) {
+    nixlXferPack* pack = handle->pack;
+    nixl_status_t ret;
+
+    if (!pack->sent) {
+        ret = handle->engine->checkXfer(handle->backendHandle);
+        if (ret != NIXL_SUCCESS) {
+            if (ret < 0)
+                pack->drop();
+            return ret;
+        }
+        pack->sent = true;
+    }
+
+    // The ack comes with the notifications of the backend, the others are
+    // kept for getNotifs. Their errors are not the ones of this write, which
+    // only fails by its ack.
+    if (pack->waiting)
+        pollNotifs(handle->engine, heldNotifs[handle->engine]);
+    return pack->waiting ? NIXL_IN_PROG : pack->ackStatus;
+}
+
+nixl_status_t nixlAgentData::unpackXfer(nixlBackendEngine* engine,
+                                        const std::string &remote_agent,
+                                        nixl_blob_t &msg, bool &has_notif) {
+    nixl_xfer_dlist_t descs(DRAM_SEG);
+    nixl_meta_dlist_t resp(DRAM_SEG);
+    nixlBasicDesc     staging;
+    std::string       ack_key;
+    uint64_t          ack_seq;
+    nixl_status_t     ret;
+    NIXL_TRACE_SCOPE("unpackXfer", "nixl");
+
+    has_notif = false;
+    ret = nixlXferPack::parse(msg, staging, descs, has_notif, ack_key, ack_seq);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    // Only memory the remote agent could have written itself is touched
+    nixl_xfer_dlist_t query = descs;
+    query.addDesc(staging);
+    if (memorySection->populate(query, engine, resp) != NIXL_SUCCESS) {
+        ret       = NIXL_ERR_NOT_FOUND;
+        has_notif = false;
+    } else {
+        nixlXferPack::scatter(staging, descs);
+    }
+
+    // The initiator completes the write, and can reuse the staging, once
+    // it receives the ack, failed scatters included
+    nixl_status_t ack_ret = engine->genNotif(remote_agent,
+                                             nixlXferPack::ackMsg(ack_key, ack_seq, ret));
+    return (ret != NIXL_SUCCESS) ? ret : ack_ret;
+}
+
+nixl_status_t nixlAgentData::pollNotifs(nixlBackendEngine* engine,
+                                        notif_list_t &notif_list) {
+    notif_list_t  bknd_notif_list;
+    nixl_status_t ret, bad_ret = NIXL_SUCCESS;
+
+    ret = engine->getNotifs(bknd_notif_list);
+    if (ret < 0)
+        bad_ret = ret;
+
+    if (telemetry && !bknd_notif_list.empty())
+        telemetry->addNotifsReceived(bknd_notif_list.size());
+
+    for (auto & elm: bknd_notif_list) {
+        if (!packKey.empty()) {
+            if (nixlXferPack::isAck(elm.second, packKey)) {
+                nixlXferPack::ack(elm.second, packWaits);
+                continue;
+            }
+
+            // Packed transfers are scattered before their notification is seen
+            if (nixlXferPack::isPacked(elm.second, packKey)) {
+                bool has_notif;
+                ret = unpackXfer(engine, elm.first, elm.second, has_notif);
+                if (ret < 0)
+                    bad_ret = ret;
+                if (!has_notif)
+                    continue;
+            }
+        }
+
+        notif_list.push_back(std::move(elm));
+    }
+    return bad_ret;
+}
+
+nixl_status_t nixlAgentData::addLocalDescs(const nixl_reg_dlist_t &descs,
+                                           nixlBackendEngine* backend,
+                                           const std::vector<nixlBackendMD*>* registered) {
+    // meta_descs use to be passed to loadLocalData
+    nixl_meta_dlist_t meta_descs(descs.getType(), false);
+    nixl_status_t ret = memorySection->addDescList(descs, backend, meta_descs,
+                                                   registered);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    if (telemetry) {
+        uint64_t bytes = 0;
+        for (auto & elm : descs)
+            bytes += elm.len;
+        telemetry->addRegBytes(backend, bytes);
+    }
+
+    // Coalesced registrations might all be covered by existing ones
+    if (!backend->supportsLocal() || meta_descs.isEmpty())
+        return NIXL_SUCCESS;
+
+    if (remoteSections.count(name) == 0)
+        setRemoteSection(name, new nixlRemoteSection(name));
+
+    ret = remoteSections[name]->loadLocalData(meta_descs, backend);
+    if (ret != NIXL_SUCCESS) {
+        // meta_descs might be merged regions, remove what was added
+        nixl_meta_dlist_t resp(descs.getType(), descs.isSorted());
+        memorySection->populate(descs.trim(), backend, resp);
+        memorySection->remDescList(resp, backend);
+    }
+    return ret;
+}
+
+
 /*** nixlAgent implementation ***/
 nixlAgent::nixlAgent(const std::string &name,
                      const nixlAgentConfig &cfg) {
@@ -167,11 +1241,16 @@ nixlAgent::createBackend(const nixl_backend_t &type,
     if (data->backendEngines.count(type)!=0)
         return NIXL_ERR_INVALID_PARAM;
 
+    // Backend sets are bitmasks of the engine ids
+    if (data->idToEngine.size() >= NIXL_MAX_BACKENDS)
+        return NIXL_ERR_NOT_ALLOWED;
+
     init_params.localAgent   = data->name;
     init_params.type         = type;
     init_params.customParams = const_cast<nixl_b_params_t*>(&params);
     init_params.enableProgTh = data->config.useProgThread;
     init_params.pthrDelay    = data->config.pthrDelay;
+    init_params.backendId    = data->idToEngine.size();
 
     // First, try to load the backend as a plugin
     auto& plugin_manager = nixlPluginManager::getInstance();
@@ -217,6 +1296,9 @@ nixlAgent::createBackend(const nixl_backend_t &type,
 
         data->backendEngines[type] = backend;
         data->backendHandles[type] = bknd_hndl;
+        data->idToEngine.push_back(backend);
+        if (data->telemetry)
+            data->telemetry->addBackend(backend);
         mems = backend->getSupportedMems();
         for (auto & elm : mems) {
             backend_list = &data->memToBackend[elm];
@@ -242,6 +1324,7 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
     backend_list_t* backend_list;
     nixl_status_t   ret;
     unsigned int    count = 0;
+    NIXL_TRACE_SCOPE("registerMem", "nixl", descs.descCount());
 
     if (!extra_params || extra_params->backends.size() == 0) {
         backend_list = &data->memToBackend[descs.getType()];
@@ -253,29 +1336,17 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
             backend_list->push_back(elm->engine);
     }
 
+    // Local (and loopback) sections are changing
+    if (data->xferCache)
+        data->xferCache->invalidate();
+
     // Best effort, if at least one succeeds NIXL_SUCCESS is returned
     // Can become more sophisticated to have a soft error case
     for (size_t i=0; i<backend_list->size(); ++i) {
-        nixlBackendEngine* backend = (*backend_list)[i];
-        // meta_descs use to be passed to loadLocalData
-        nixl_meta_dlist_t meta_descs(descs.getType(), false);
-        ret = data->memorySection->addDescList(descs, backend, meta_descs);
-        if (ret == NIXL_SUCCESS) {
-            if (backend->supportsLocal()) {
-                if (data->remoteSections.count(data->name) == 0)
-                    data->remoteSections[data->name] =
-                          new nixlRemoteSection(data->name);
-
-                ret = data->remoteSections[data->name]->loadLocalData(
-                                                        meta_descs, backend);
-                if (ret == NIXL_SUCCESS)
-                    count++;
-                else
-                    data->memorySection->remDescList(meta_descs, backend);
-            } else {
-                count++;
-            }
-        } // a bad_ret can be saved in an else
+        ret = data->addLocalDescs(descs, (*backend_list)[i]);
+        if (ret == NIXL_SUCCESS)
+            count++;
+        // a bad_ret can be saved in an else
     }
 
     if (extra_params && extra_params->backends.size() > 0)
@@ -292,25 +1363,27 @@ nixlAgent::deregisterMem(const nixl_reg_dlist_t &descs,
                          const nixl_opt_args_t* extra_params) {
 
 
-    backend_set_t     backend_set;
+    backend_mask_t    backend_mask = 0;
     nixl_status_t     ret, bad_ret=NIXL_SUCCESS;
     nixl_xfer_dlist_t trimmed = descs.trim();
 
     if (!extra_params || extra_params->backends.size() == 0) {
-        backend_set_t* avail_backends;
-        avail_backends = data->memorySection->queryBackends(
-                                              descs.getType());
-        if (!avail_backends || avail_backends->empty())
+        // A copy, as we might change it in remDescList
+        backend_mask = data->memorySection->queryBackends(descs.getType());
+        if (!backend_mask)
             return NIXL_ERR_NOT_FOUND;
-        // Make a copy as we might change it in remDescList
-        backend_set = *avail_backends;
     } else {
         for (auto & elm : extra_params->backends)
-            backend_set.insert(elm->engine);
+            backend_mask |= backendBit(elm->engine);
     }
 
+    // Cached preparations might point to the metadata being removed
+    if (data->xferCache)
+        data->xferCache->invalidate();
+
     // Doing best effort, and returning err if any
-    for (auto & backend : backend_set) {
+    while (backend_mask) {
+        nixlBackendEngine* backend = data->idToEngine[popBackend(backend_mask)];
         nixl_meta_dlist_t resp(descs.getType(),
                                descs.isSorted());
 
@@ -320,13 +1393,296 @@ nixlAgent::deregisterMem(const nixl_reg_dlist_t &descs,
         if (ret != NIXL_SUCCESS)
             bad_ret = ret;
         ret = data->memorySection->remDescList(resp, backend);
-        if (ret != NIXL_SUCCESS)
+        if (ret != NIXL_SUCCESS) {
             bad_ret = ret;
+        } else if (data->telemetry) {
+            uint64_t bytes = 0;
+            for (auto & elm : resp)
+                bytes += elm.len;
+            data->telemetry->remRegBytes(backend, bytes);
+        }
     }
 
     return bad_ret;
 }
 
+nixl_status_t
+nixlAgent::releasedMem(const nixl_xfer_dlist_t &descs) {
+    return data->memorySection->releasedMem(descs);
+}
+
+// registerMemAsync pre-faults DRAM in chunks of this size, as faulting in the
+// pages is most of the cost of pinning them, and serial within a registration
+static const size_t regPrefaultChunk = 64 << 20;
+
+// Runs count tasks of a registration request on the pool, and next from the
+// last one to end, or right away without tasks. pending counts the tasks left.
+static void regPhase(nixlThreadPool* pool, std::atomic<size_t> &pending,
+                     const size_t count, std::function<void(size_t)> task,
+                     std::function<void()> next) {
+    if (count == 0) {
+        next();
+        return;
+    }
+
+    auto funcs = std::make_shared<std::pair<std::function<void(size_t)>,
+                                            std::function<void()>>>(
+                                                std::move(task), std::move(next));
+    pending.store(count, std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        pool->submit([&pending, funcs, i] {
+            funcs->first(i);
+            if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                funcs->second();
+        });
+    }
+}
+
+nixl_status_t
+nixlAgent::registerMemAsync(const nixl_reg_dlist_t &descs,
+                            nixlRegReqH* &req_hndl,
+                            const nixl_opt_args_t* extra_params) {
+
+    nixl_mem_t   mem_type = descs.getType();
+    nixlRegReqH*    req;
+    nixlThreadPool* pool;
+
+    if ((mem_type < DRAM_SEG) || (mem_type > FILE_SEG))
+        return NIXL_ERR_INVALID_PARAM;
+
+    req = new nixlRegReqH(descs);
+    if (!extra_params || extra_params->backends.size() == 0) {
+        req->backends = data->memToBackend[mem_type];
+        if (req->backends.empty()) {
+            delete req;
+            return NIXL_ERR_NOT_FOUND;
+        }
+    } else {
+        for (auto & elm : extra_params->backends)
+            req->backends.push_back(elm->engine);
+    }
+
+    req->preRegistered = data->memorySection->registersDirectly(mem_type);
+    req->metadata.assign(req->backends.size(),
+                         std::vector<nixlBackendMD*>(descs.descCount(), nullptr));
+    req->rets.assign(req->backends.size(),
+                     std::vector<nixl_status_t>(descs.descCount(),
+                                                NIXL_ERR_NOT_POSTED));
+
+#ifdef MADV_POPULATE_WRITE
+    if (mem_type == DRAM_SEG) {
+        uintptr_t page_mask = ~((uintptr_t) sysconf(_SC_PAGESIZE) - 1);
+        for (auto & elm : descs) {
+            uintptr_t end = elm.addr + elm.len;
+            for (uintptr_t start = elm.addr & page_mask; start < end;
+                 start += regPrefaultChunk)
+                req->chunks.push_back({start, std::min(regPrefaultChunk,
+                                                       end - start)});
+        }
+    }
+#endif
+
+    // Other backends are registered by getRegStatus on the agent thread,
+    // as their registration can race with their data path
+    if (req->preRegistered)
+        for (size_t b = 0; b < req->backends.size(); ++b)
+            if (req->backends[b]->supportsParallelReg())
+                for (int i = 0; i < descs.descCount(); ++i)
+                    req->regTasks.push_back({b, i});
+
+    // Shared by the registration requests of the agent, with workerThreads
+    // workers running their tasks, and apart from workerPool so a long
+    // pre-fault does not hold back the preparations of the agent thread
+    if (!data->regPool)
+        data->regPool = new nixlThreadPool(
+                            std::max(data->config.workerThreads, (size_t) 1) + 1);
+    pool = data->regPool;
+    data->regReqs.insert(req);
+
+    // Best effort pre-fault, registration faults in whatever is left
+    regPhase(pool, req->pending, req->chunks.size(), [req](size_t i) {
+#ifdef MADV_POPULATE_WRITE
+        madvise((void*) req->chunks[i].first, req->chunks[i].second,
+                MADV_POPULATE_WRITE);
+#endif
+    }, [req, pool] {
+        regPhase(pool, req->pending, req->regTasks.size(), [req](size_t t) {
+            size_t b = req->regTasks[t].first;
+            int    i = req->regTasks[t].second;
+            req->rets[b][i] = req->backends[b]->registerMem(
+                                  req->descs[i], req->descs.getType(),
+                                  req->metadata[b][i]);
+        }, [req] { req->finish(); });
+    });
+
+    req_hndl = req;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getRegStatus(nixlRegReqH* req_hndl) {
+    unsigned int  count = 0;
+    nixl_status_t ret;
+
+    if (!req_hndl)
+        return NIXL_ERR_INVALID_PARAM;
+    if (req_hndl->committed)
+        return req_hndl->status;
+    if (!req_hndl->done.load(std::memory_order_acquire))
+        return NIXL_IN_PROG;
+
+    req_hndl->committed = true;
+    data->regReqs.erase(req_hndl);
+
+    if (req_hndl->preRegistered) {
+        for (size_t b = 0; b < req_hndl->backends.size(); ++b) {
+            nixlBackendEngine* backend = req_hndl->backends[b];
+            if (backend->supportsParallelReg())
+                continue;
+            for (int i = 0; i < req_hndl->descs.descCount(); ++i) {
+                req_hndl->rets[b][i] = backend->registerMem(
+                                           req_hndl->descs[i], req_hndl->descs.getType(),
+                                           req_hndl->metadata[b][i]);
+                if (req_hndl->rets[b][i] != NIXL_SUCCESS)
+                    break;
+            }
+        }
+    }
+
+    // Local (and loopback) sections are changing
+    if (data->xferCache)
+        data->xferCache->invalidate();
+
+    // Same as registerMem, best effort over the backends, and each backend
+    // gets all the descriptors or none of them
+    for (size_t b = 0; b < req_hndl->backends.size(); ++b) {
+        nixlBackendEngine* backend = req_hndl->backends[b];
+        std::vector<nixl_status_t> &rets = req_hndl->rets[b];
+
+        if (req_hndl->preRegistered &&
+            (std::count(rets.begin(), rets.end(), NIXL_SUCCESS) !=
+             (long) rets.size())) {
+            for (size_t i = 0; i < rets.size(); ++i)
+                if (rets[i] == NIXL_SUCCESS)
+                    backend->deregisterMem(req_hndl->metadata[b][i]);
+            continue;
+        }
+
+        ret = data->addLocalDescs(req_hndl->descs, backend,
+                                  req_hndl->preRegistered ?
+                                  &req_hndl->metadata[b] : nullptr);
+        if (ret == NIXL_SUCCESS)
+            count++;
+    }
+
+    req_hndl->status = (count > 0) ? NIXL_SUCCESS : NIXL_ERR_BACKEND;
+    return req_hndl->status;
+}
+
+nixl_status_t
+nixlAgent::releaseRegReq(nixlRegReqH* req_hndl) {
+    if (!req_hndl)
+        return NIXL_ERR_INVALID_PARAM;
+
+    req_hndl->wait();
+    data->regReqs.erase(req_hndl);
+
+    // Not collected by getRegStatus, so the registration is undone
+    if (!req_hndl->committed && req_hndl->preRegistered)
+        for (size_t b = 0; b < req_hndl->backends.size(); ++b)
+            for (size_t i = 0; i < req_hndl->rets[b].size(); ++i)
+                if (req_hndl->rets[b][i] == NIXL_SUCCESS)
+                    req_hndl->backends[b]->deregisterMem(
+                                               req_hndl->metadata[b][i]);
+
+    delete req_hndl;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::allocMem(const size_t &size,
+                    const nixl_mem_t &mem_type,
+                    nixlBlobDesc &desc,
+                    const nixl_opt_args_t* extra_params) {
+
+    backend_mask_t backend_mask = 0;
+    int            numa_node    = -1;
+    uintptr_t      addr;
+    nixl_status_t  ret;
+
+    if (mem_type != DRAM_SEG)
+        return NIXL_ERR_NOT_SUPPORTED;
+    if (size == 0)
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (!extra_params || extra_params->backends.size() == 0) {
+        for (auto & elm : data->memToBackend[mem_type])
+            backend_mask |= backendBit(elm);
+    } else {
+        for (auto & elm : extra_params->backends)
+            backend_mask |= backendBit(elm->engine);
+    }
+    if (!backend_mask)
+        return NIXL_ERR_NOT_FOUND;
+
+    if (extra_params)
+        numa_node = extra_params->numaNode;
+
+    for (auto & elm : data->arenas) {
+        nixlMemArena* arena = elm.second;
+        if ((arena->getNumaNode() == numa_node) &&
+            ((arena->backends & backend_mask) == backend_mask) &&
+            (arena->alloc(size, addr) == NIXL_SUCCESS)) {
+            desc = nixlBlobDesc(addr, size, 0);
+            return NIXL_SUCCESS;
+        }
+    }
+
+    // No arena with enough space, a new one is mapped and registered once
+    nixlMemArena* arena = new nixlMemArena(std::max(data->config.allocArenaSize,
+                                                    size), numa_node);
+    if (arena->getInitErr()) {
+        delete arena;
+        return NIXL_ERR_UNKNOWN;
+    }
+
+    // Taken before registering, so a failure has nothing to deregister
+    ret = arena->alloc(size, addr);
+    if (ret != NIXL_SUCCESS) {
+        delete arena;
+        return ret;
+    }
+
+    if (data->xferCache)
+        data->xferCache->invalidate();
+
+    // Best effort like registerMem, but keeping the backends that succeeded,
+    // so only those are matched when reusing the arena
+    nixl_reg_dlist_t arena_descs(mem_type);
+    arena_descs.addDesc(nixlBlobDesc(arena->getAddr(), arena->getSize(), 0));
+    while (backend_mask) {
+        nixlBackendEngine* backend = data->idToEngine[popBackend(backend_mask)];
+        if (data->addLocalDescs(arena_descs, backend) == NIXL_SUCCESS)
+            arena->backends |= backendBit(backend);
+    }
+    if (!arena->backends) {
+        delete arena;
+        return NIXL_ERR_BACKEND;
+    }
+    data->arenas[arena->getAddr()] = arena;
+
+    desc = nixlBlobDesc(addr, size, 0);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::freeMem(const nixlBlobDesc &desc) {
+    auto it = data->arenas.upper_bound(desc.addr);
+    if (it == data->arenas.begin())
+        return NIXL_ERR_NOT_FOUND;
+    return std::prev(it)->second->free(desc.addr);
+}
+
 nixl_status_t
 nixlAgent::makeConnection(const std::string &remote_agent,
                           const nixl_opt_args_t* extra_params) {
@@ -376,11 +1732,10 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
                           nixlDlistH* &dlist_hndl,
                           const nixl_opt_args_t* extra_params) const {
 
-    // Using a set as order is not important to revert the operation
-    backend_set_t* backend_set;
-    nixl_status_t  ret;
+    backend_mask_t backend_mask = 0;
     int            count = 0;
     bool           init_side = (agent_name == NIXL_INIT_AGENT);
+    NIXL_TRACE_SCOPE("prepXferDlist", "nixl", descs.descCount());
 
     // When central KV is supported, still it should return error,
     // just we can add a call to fetchRemoteMD for next time
@@ -389,18 +1744,17 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
 
     if (!extra_params || extra_params->backends.size() == 0) {
         if (!init_side)
-            backend_set = data->remoteSections[agent_name]->
-                                queryBackends(descs.getType());
+            backend_mask = data->remoteSections[agent_name]->
+                                 queryBackends(descs.getType());
         else
-            backend_set = data->memorySection->
-                                queryBackends(descs.getType());
+            backend_mask = data->memorySection->
+                                 queryBackends(descs.getType());
 
-        if (!backend_set || backend_set->empty())
+        if (!backend_mask)
             return NIXL_ERR_NOT_FOUND;
     } else {
-        backend_set = new backend_set_t();
         for (auto & elm : extra_params->backends)
-            backend_set->insert(elm->engine);
+            backend_mask |= backendBit(elm->engine);
     }
 
     // TODO [Perf]: Avoid heap allocation on the datapath, maybe use a mem pool
@@ -412,29 +1766,38 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
     } else {
         handle->isLocal     = false;
         handle->remoteAgent = agent_name;
+        handle->remoteId    = data->getAgentId(agent_name);
     }
 
-    for (auto & backend : *backend_set) {
-        handle->descs[backend] = new nixl_meta_dlist_t (
-                                         descs.getType(),
-                                         descs.isSorted());
-        if (init_side)
-            ret = data->memorySection->populate(
-                       descs, backend, *(handle->descs[backend]));
-        else
-            ret = data->remoteSections[agent_name]->populate(
-                       descs, backend, *(handle->descs[backend]));
-        if (ret == NIXL_SUCCESS) {
+    std::vector<nixlBackendEngine*> backends;
+    std::vector<nixl_meta_dlist_t*> resps;
+
+    while (backend_mask)
+        backends.push_back(data->idToEngine[popBackend(backend_mask)]);
+    std::vector<nixl_status_t>      rets;
+
+    for (size_t i = 0; i < backends.size(); ++i)
+        resps.push_back(new nixl_meta_dlist_t (descs.getType(),
+                                               descs.isSorted(),
+                                               descs.descCount()));
+
+    if (init_side)
+        data->memorySection->populate(descs, backends, resps, rets,
+                                      data->workerPool);
+    else
+        data->remoteSections[agent_name]->populate(descs, backends, resps,
+                                                   rets, data->workerPool);
+
+    for (size_t i = 0; i < backends.size(); ++i) {
+        if (rets[i] == NIXL_SUCCESS) {
+            handle->descs[backends[i]] = resps[i];
+            handle->backends |= backendBit(backends[i]);
             count++;
         } else {
-            delete handle->descs[backend];
-            handle->descs.erase(backend);
+            delete resps[i];
         }
     }
 
-    if (extra_params && extra_params->backends.size() > 0)
-        delete backend_set;
-
     if (count == 0) {
         delete handle;
         dlist_hndl = nullptr;
@@ -445,6 +1808,64 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
     }
 }
 
+// Two consecutive descriptors of a transfer can be merged if they are back to
+// back on both sides, within the same device and registered memory.
+static inline bool descsMergeable(const nixlMetaDesc &local_desc1,
+                                  const nixlMetaDesc &local_desc2,
+                                  const nixlMetaDesc &remote_desc1,
+                                  const nixlMetaDesc &remote_desc2) {
+    return (((local_desc1.addr + local_desc1.len) == local_desc2.addr)
+         && ((remote_desc1.addr + remote_desc1.len) == remote_desc2.addr)
+         && (local_desc1.metadataP == local_desc2.metadataP)
+         && (remote_desc1.metadataP == remote_desc2.metadataP)
+         && (local_desc1.devId == local_desc2.devId)
+         && (remote_desc1.devId == remote_desc2.devId));
+}
+
+// Validates the selected indices, and finds out if the selection is contiguous
+// or has descriptors to merge. The merge check is compiled out when merging is
+// skipped, so the choice is made once per request and not per descriptor.
+template <bool check_merge>
+static nixl_status_t checkXferIndices(const nixl_meta_dlist_t &local_descs,
+                                      const std::vector<int> &local_indices,
+                                      const nixl_meta_dlist_t &remote_descs,
+                                      const std::vector<int> &remote_indices,
+                                      bool &contiguous,
+                                      bool &mergeable) {
+    int  desc_count   = (int) local_indices.size();
+    int  local_count  = local_descs.descCount();
+    int  remote_count = remote_descs.descCount();
+    auto local        = local_descs.begin();
+    auto remote       = remote_descs.begin();
+
+    contiguous = true;
+    mergeable  = false;
+
+    for (int i=0; i<desc_count; ++i) {
+        int l = local_indices[i];
+        int r = remote_indices[i];
+
+        if ((l >= local_count) || (l < 0) || (r >= remote_count) || (r < 0))
+            return NIXL_ERR_INVALID_PARAM;
+        if (local[l].len != remote[r].len)
+            return NIXL_ERR_INVALID_PARAM;
+
+        // Find out if the selection can be viewed without copying
+        if (i > 0) {
+            if ((l != local_indices[i-1] + 1) || (r != remote_indices[i-1] + 1))
+                contiguous = false;
+            if constexpr (check_merge) {
+                if (!mergeable)
+                    mergeable = descsMergeable(local [local_indices [i-1]],
+                                               local [l],
+                                               remote[remote_indices[i-1]],
+                                               remote[r]);
+            }
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
                         const nixlDlistH* local_side,
@@ -458,6 +1879,7 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
     nixl_status_t      ret;
     int                desc_count = (int) local_indices.size();
     nixlBackendEngine* backend    = nullptr;
+    NIXL_TRACE_SCOPE("makeXferReq", "nixl", desc_count);
 
     req_hndl = nullptr;
 
@@ -468,53 +1890,46 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
 
     // The remote was invalidated in between prepXferDlist and this call
-    if (data->remoteSections.count(remote_side->remoteAgent) == 0) {
-        delete req_hndl;
+    if (!data->remoteById[remote_side->remoteId])
         return NIXL_ERR_NOT_FOUND;
-    }
+
+    backend_mask_t common = local_side->backends & remote_side->backends;
 
     if (extra_params && extra_params->backends.size() > 0) {
         for (auto & elm : extra_params->backends) {
-            if ((local_side->descs.count(elm->engine) > 0) &&
-                (remote_side->descs.count(elm->engine) > 0)) {
+            if (common & backendBit(elm->engine)) {
                 backend = elm->engine;
                 break;
             }
         }
-    } else {
-        for (auto & loc_bknd : local_side->descs) {
-            for (auto & rem_bknd : remote_side->descs) {
-                if (loc_bknd.first == rem_bknd.first) {
-                    backend = loc_bknd.first;
-                    break;
-                }
-            }
-            if (backend)
-                break;
-        }
+    } else if (common) {
+        backend = data->idToEngine[popBackend(common)];
     }
 
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
 
-    nixl_meta_dlist_t* local_descs  = local_side->descs.at(backend);
-    nixl_meta_dlist_t* remote_descs = remote_side->descs.at(backend);
+    const nixl_meta_dlist_t* local_descs  = local_side->descs.at(backend);
+    const nixl_meta_dlist_t* remote_descs = remote_side->descs.at(backend);
 
     if ((desc_count == 0) || (remote_indices.size() == 0) ||
         (desc_count != (int) remote_indices.size()))
         return NIXL_ERR_INVALID_PARAM;
 
-    for (int i=0; i<desc_count; ++i) {
-        if ((local_indices[i] >= local_descs->descCount())
-               || (local_indices[i]<0))
-            return NIXL_ERR_INVALID_PARAM;
-        if ((remote_indices[i] >= remote_descs->descCount())
-               || (remote_indices[i]<0))
-            return NIXL_ERR_INVALID_PARAM;
-        if ((*local_descs )[local_indices [i]].len !=
-            (*remote_descs)[remote_indices[i]].len)
-            return NIXL_ERR_INVALID_PARAM;
-    }
+    bool contiguous, mergeable;
+
+    // Segments are given in descriptors, so they are kept as is
+    if (extra_params && (extra_params->skipDescMerge ||
+                         !extra_params->segments.empty()))
+        ret = checkXferIndices<false>(*local_descs, local_indices,
+                                      *remote_descs, remote_indices,
+                                      contiguous, mergeable);
+    else
+        ret = checkXferIndices<true>(*local_descs, local_indices,
+                                     *remote_descs, remote_indices,
+                                     contiguous, mergeable);
+    if (ret != NIXL_SUCCESS)
+        return ret;
 
     if (extra_params && extra_params->hasNotif) {
         opt_args.notifMsg = extra_params->notifMsg;
@@ -525,60 +1940,73 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         return NIXL_ERR_BACKEND;
     }
 
-    // Populate has been already done, no benefit in having sorted descriptors
-    // which will be overwritten by [] assignment operator.
-    nixlXferReqH* handle   = new nixlXferReqH;
-    handle->initiatorDescs = new nixl_meta_dlist_t (
-                                     local_descs->getType(),
-                                     false, desc_count);
-
-    handle->targetDescs    = new nixl_meta_dlist_t (
-                                     remote_descs->getType(),
-                                     false, desc_count);
-
-    if (extra_params && extra_params->skipDescMerge) {
-        for (int i=0; i<desc_count; ++i) {
-            (*handle->initiatorDescs)[i] =
-                                     (*local_descs)[local_indices[i]];
-            (*handle->targetDescs)[i] =
-                                     (*remote_descs)[remote_indices[i]];
+    nixlXferReqH* handle = new nixlXferReqH;
+
+    if (!mergeable) {
+        // Nothing to merge, so the request views directly into the prepared
+        // lists, and keeps their handles alive until the request is released.
+        if (contiguous) {
+            handle->initiatorView = nixl_meta_dview_t(*local_descs,
+                                                      local_indices[0],
+                                                      desc_count);
+            handle->targetView    = nixl_meta_dview_t(*remote_descs,
+                                                      remote_indices[0],
+                                                      desc_count);
+        } else {
+            handle->initiatorIdx  = local_indices;
+            handle->targetIdx     = remote_indices;
+            handle->initiatorView = nixl_meta_dview_t(*local_descs,
+                                                      handle->initiatorIdx.data(),
+                                                      desc_count);
+            handle->targetView    = nixl_meta_dview_t(*remote_descs,
+                                                      handle->targetIdx.data(),
+                                                      desc_count);
         }
-    } else {
-        int i = 0, j = 0; //final list size
-        while (i<(desc_count)) {
-            nixlMetaDesc local_desc1  = (*local_descs) [local_indices[i]];
-            nixlMetaDesc remote_desc1 = (*remote_descs)[remote_indices[i]];
-
-            if(i != (desc_count-1) ) {
-                nixlMetaDesc* local_desc2  = &((*local_descs) [local_indices[i+1]]);
-                nixlMetaDesc* remote_desc2 = &((*remote_descs)[remote_indices[i+1]]);
 
-              while (((local_desc1.addr + local_desc1.len) == local_desc2->addr)
-                  && ((remote_desc1.addr + remote_desc1.len) == remote_desc2->addr)
-                  && (local_desc1.metadataP == local_desc2->metadataP)
-                  && (remote_desc1.metadataP == remote_desc2->metadataP)
-                  && (local_desc1.devId == local_desc2->devId)
-                  && (remote_desc1.devId == remote_desc2->devId)) {
+        handle->localSide  = local_side;
+        handle->remoteSide = remote_side;
+        local_side->xferRefs++;
+        remote_side->xferRefs++;
+    } else {
+        // Populate has been already done, no benefit in having sorted descriptors
+        // which will be overwritten by [] assignment operator.
+        handle->initiatorDescs = new nixl_meta_dlist_t (
+                                         local_descs->getType(),
+                                         false, desc_count);
 
-                    local_desc1.len += local_desc2->len;
-                    remote_desc1.len += remote_desc2->len;
+        handle->targetDescs    = new nixl_meta_dlist_t (
+                                         remote_descs->getType(),
+                                         false, desc_count);
 
-                    i++;
-                    if(i == (desc_count-1)) break;
+        auto local  = local_descs->begin();
+        auto remote = remote_descs->begin();
+        auto l_out  = handle->initiatorDescs->begin();
+        auto r_out  = handle->targetDescs->begin();
 
-                    local_desc2  = &((*local_descs) [local_indices[i+1]]);
-                    remote_desc2 = &((*remote_descs)[remote_indices[i+1]]);
-                }
+        int i = 0, j = 0; //final list size
+        while (i<(desc_count)) {
+            nixlMetaDesc local_desc1  = local [local_indices [i]];
+            nixlMetaDesc remote_desc1 = remote[remote_indices[i]];
+
+            while ((i != (desc_count-1)) &&
+                   descsMergeable(local_desc1,  local [local_indices [i+1]],
+                                  remote_desc1, remote[remote_indices[i+1]])) {
+                local_desc1.len  += local [local_indices [i+1]].len;
+                remote_desc1.len += remote[remote_indices[i+1]].len;
+                i++;
             }
 
-            (*handle->initiatorDescs)[j] = local_desc1;
-            (*handle->targetDescs)   [j] = remote_desc1;
+            l_out[j] = local_desc1;
+            r_out[j] = remote_desc1;
             j++;
             i++;
         }
 
         handle->initiatorDescs->resize(j);
         handle->targetDescs->resize(j);
+
+        handle->initiatorView = *handle->initiatorDescs;
+        handle->targetView    = *handle->targetDescs;
     }
 
     // To be added to logging
@@ -586,17 +2014,385 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
 
     handle->engine      = backend;
     handle->remoteAgent = remote_side->remoteAgent;
+    handle->remoteId    = remote_side->remoteId;
     handle->notifMsg    = opt_args.notifMsg;
     handle->hasNotif    = opt_args.hasNotif;
+    handle->timeout     = extra_params ? extra_params->timeoutUs : 0;
     handle->backendOp   = operation;
     handle->status      = NIXL_ERR_NOT_POSTED;
 
-    ret = handle->engine->prepXfer (handle->backendOp,
-                                    *handle->initiatorDescs,
-                                    *handle->targetDescs,
-                                    handle->remoteAgent,
-                                    handle->backendHandle,
-                                    &opt_args);
+    if (extra_params && !extra_params->segments.empty()) {
+        ret = data->makeSegments(handle, extra_params);
+        if (ret != NIXL_SUCCESS) {
+            delete handle;
+            return ret;
+        }
+    }
+
+    if (data->telemetry)
+        data->initXferStats(handle, desc_count);
+    data->initXferPrio(handle, extra_params);
+    opt_args.priority = handle->priority;
+
+    if (!handle->segments.empty()) {
+        ret = data->prepSegments(handle, opt_args);
+    } else {
+        NIXL_TRACE_SCOPE("backend.prepXfer", "nixl",
+                         handle->initiatorView.descCount());
+        ret = handle->engine->prepXfer (handle->backendOp,
+                                        handle->initiatorView,
+                                        handle->targetView,
+                                        handle->remoteAgent,
+                                        handle->backendHandle,
+                                        &opt_args);
+    }
+    if (ret != NIXL_SUCCESS) {
+        delete handle;
+        return ret;
+    }
+    data->initLocalCopy(handle);
+
+    ret = data->initPack(handle, extra_params);
+    if (ret != NIXL_SUCCESS) {
+        delete handle;
+        return ret;
+    }
+
+    req_hndl = handle;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
+                         const nixl_xfer_dlist_t &local_descs,
+                         const nixl_xfer_dlist_t &remote_descs,
+                         const std::string &remote_agent,
+                         nixlXferReqH* &req_hndl,
+                         const nixl_opt_args_t* extra_params) const {
+    nixl_status_t     ret1, ret2;
+    nixl_opt_b_args_t opt_args;
+    backend_mask_t    backend_mask = 0;
+    NIXL_TRACE_SCOPE("createXferReq", "nixl", local_descs.descCount());
+
+    req_hndl = nullptr;
+
+    if (data->remoteSections.count(remote_agent) == 0)
+        return NIXL_ERR_NOT_FOUND;
+
+    // Check the correspondence between descriptor lists
+    if (local_descs.descCount() != remote_descs.descCount())
+        return NIXL_ERR_INVALID_PARAM;
+    for (int i=0; i<local_descs.descCount(); ++i)
+        if (local_descs[i].len != remote_descs[i].len)
+            return NIXL_ERR_INVALID_PARAM;
+
+    if (data->config.stripeXfers &&
+        !(extra_params && !extra_params->segments.empty())) {
+        ret1 = data->makeStripedReq(operation, local_descs, remote_descs,
+                                    remote_agent, extra_params, req_hndl);
+        if ((ret1 != NIXL_SUCCESS) || req_hndl)
+            return ret1;
+    }
+
+    if (data->xferCache) {
+        nixlDlistH*             local_side;
+        nixlDlistH*             remote_side;
+        const std::vector<int>* indices;
+        nixl_opt_args_t         cache_args;
+        uint64_t                hash = nixlXferCache::getHash(local_descs,
+                                                              remote_descs,
+                                                              remote_agent,
+                                                              extra_params);
+
+        if (!data->xferCache->lookup(hash, local_descs, remote_descs,
+                                     remote_agent, extra_params, local_side,
+                                     remote_side, indices)) {
+            ret1 = prepXferDlist(NIXL_INIT_AGENT, local_descs,
+                                 local_side, extra_params);
+            if (ret1 != NIXL_SUCCESS)
+                return ret1;
+
+            ret2 = prepXferDlist(remote_agent, remote_descs,
+                                 remote_side, extra_params);
+            if (ret2 != NIXL_SUCCESS) {
+                releasedDlistH(local_side);
+                return ret2;
+            }
+
+            indices = data->xferCache->insert(hash, local_descs, remote_descs,
+                                              remote_agent, extra_params,
+                                              local_side, remote_side);
+        }
+
+        // Same descriptors as below without merging, so the request
+        // directly views into the cached lists, as they are contiguous.
+        if (extra_params)
+            cache_args = *extra_params;
+        cache_args.skipDescMerge = true;
+
+        return makeXferReq(operation, local_side, *indices, remote_side,
+                           *indices, req_hndl, &cache_args);
+    }
+
+    if (!extra_params || extra_params->backends.size() == 0) {
+        // Finding backends that support the corresponding memories
+        // locally and remotely, and find the common ones.
+        backend_mask =
+            data->memorySection->queryBackends(local_descs.getType()) &
+            data->remoteSections[remote_agent]->queryBackends(
+                                                remote_descs.getType());
+        if (!backend_mask)
+            return NIXL_ERR_NOT_FOUND;
+    } else {
+        for (auto & elm : extra_params->backends)
+            backend_mask |= backendBit(elm->engine);
+    }
+
+    // TODO: when central KV is supported, add a call to fetchRemoteMD
+    // TODO: merge descriptors back to back in memory (like makeXferReq).
+    // TODO [Perf]: Avoid heap allocation on the datapath, maybe use a mem pool
+
+    nixlXferReqH *handle   = new nixlXferReqH;
+    handle->initiatorDescs = new nixl_meta_dlist_t (
+                                     local_descs.getType(),
+                                     local_descs.isSorted());
+
+    handle->targetDescs    = new nixl_meta_dlist_t (
+                                     remote_descs.getType(),
+                                     remote_descs.isSorted());
+
+    // Currently we loop through and find first local match, in the order
+    // the backends were created. Can use a more exhaustive search.
+    while (backend_mask) {
+        nixlBackendEngine* backend = data->idToEngine[popBackend(backend_mask)];
+        // If populate fails, it clears the resp before return
+        ret1 = data->memorySection->populate(
+                     local_descs, backend, *handle->initiatorDescs);
+        ret2 = data->remoteSections[remote_agent]->populate(
+                     remote_descs, backend, *handle->targetDescs);
+
+        if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS)) {
+            // For Logging:
+            // std::cout << "Selected backend: " << backend->getType() << "\n";
+            handle->engine = backend;
+            break;
+        }
+    }
+
+    if (!handle->engine) {
+        delete handle;
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    if (extra_params && extra_params->hasNotif) {
+        opt_args.notifMsg = extra_params->notifMsg;
+        opt_args.hasNotif = true;
+    }
+
+    if (opt_args.hasNotif && (!handle->engine->supportsNotif())) {
+        delete handle;
+        return NIXL_ERR_BACKEND;
+    }
+
+    handle->remoteAgent = remote_agent;
+    handle->remoteId    = data->getAgentId(remote_agent);
+    handle->backendOp   = operation;
+    handle->status      = NIXL_ERR_NOT_POSTED;
+    handle->notifMsg    = opt_args.notifMsg;
+    handle->hasNotif    = opt_args.hasNotif;
+    handle->timeout     = extra_params ? extra_params->timeoutUs : 0;
+
+    handle->initiatorView = *handle->initiatorDescs;
+    handle->targetView    = *handle->targetDescs;
+
+    if (extra_params && !extra_params->segments.empty()) {
+        ret1 = data->makeSegments(handle, extra_params);
+        if (ret1 != NIXL_SUCCESS) {
+            delete handle;
+            return ret1;
+        }
+    }
+
+    if (data->telemetry)
+        data->initXferStats(handle, local_descs.descCount());
+    data->initXferPrio(handle, extra_params);
+    opt_args.priority = handle->priority;
+
+    if (!handle->segments.empty()) {
+        ret1 = data->prepSegments(handle, opt_args);
+    } else {
+        NIXL_TRACE_SCOPE("backend.prepXfer", "nixl",
+                         handle->initiatorView.descCount());
+        ret1 = handle->engine->prepXfer (handle->backendOp,
+                                         handle->initiatorView,
+                                         handle->targetView,
+                                         handle->remoteAgent,
+                                         handle->backendHandle,
+                                         &opt_args);
+    }
+    if (ret1 != NIXL_SUCCESS) {
+        delete handle;
+        return ret1;
+    }
+    data->initLocalCopy(handle);
+
+    ret1 = data->initPack(handle, extra_params);
+    if (ret1 != NIXL_SUCCESS) {
+        delete handle;
+        return ret1;
+    }
+
+    req_hndl = handle;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::makeBcastXferReq (const nixlDlistH* local_side,
+                             const std::vector<int> &local_indices,
+                             const std::vector<const nixlDlistH*> &remote_sides,
+                             const std::vector<int> &remote_indices,
+                             nixlXferReqH* &req_hndl,
+                             const nixl_opt_args_t* extra_params) const {
+    nixl_opt_args_t part_params;
+    nixl_status_t   ret;
+    NIXL_TRACE_SCOPE("makeBcastXferReq", "nixl", remote_sides.size());
+
+    req_hndl = nullptr;
+
+    if (remote_sides.empty())
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (extra_params) {
+        if (!extra_params->segments.empty())
+            return NIXL_ERR_INVALID_PARAM;
+        part_params = *extra_params;
+    }
+
+    // The notification is given by the handle to each part at post time
+    part_params.hasNotif = false;
+    part_params.notifMsg.clear();
+    // Staging buffers are of a single peer, the parts are sent directly
+    part_params.packStagingLen = 0;
+
+    nixlXferReqH* handle = new nixlXferReqH;
+
+    // Each destination is a full request, viewing into the same local side
+    for (auto & remote_side : remote_sides) {
+        nixlXferReqH* part;
+
+        ret = makeXferReq(NIXL_WRITE, local_side, local_indices,
+                          remote_side, remote_indices, part, &part_params);
+        if (ret != NIXL_SUCCESS) {
+            delete handle;
+            return ret;
+        }
+        handle->peerParts.push_back(part);
+    }
+
+    ret = data->joinPeerParts(handle, NIXL_WRITE, extra_params);
+    if (ret != NIXL_SUCCESS) {
+        delete handle;
+        return ret;
+    }
+
+    req_hndl = handle;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::createBcastXferReq (const nixl_xfer_dlist_t &local_descs,
+                               const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                               const std::vector<std::string> &remote_agents,
+                               nixlXferReqH* &req_hndl,
+                               const nixl_opt_args_t* extra_params) const {
+    std::vector<const nixlDlistH*> remote_sides;
+    std::vector<nixlDlistH*>       prepped;
+    nixlDlistH*                    dlist_hndl;
+    nixl_status_t                  ret;
+
+    req_hndl = nullptr;
+
+    if (remote_descs.empty() || (remote_descs.size() != remote_agents.size()))
+        return NIXL_ERR_INVALID_PARAM;
+
+    for (auto & descs : remote_descs)
+        if (descs.descCount() != local_descs.descCount())
+            return NIXL_ERR_INVALID_PARAM;
+
+    ret = prepXferDlist(NIXL_INIT_AGENT, local_descs, dlist_hndl, extra_params);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+    prepped.push_back(dlist_hndl);
+
+    for (size_t i = 0; (i < remote_descs.size()) && (ret == NIXL_SUCCESS); ++i) {
+        ret = prepXferDlist(remote_agents[i], remote_descs[i], dlist_hndl,
+                            extra_params);
+        if (ret == NIXL_SUCCESS) {
+            prepped.push_back(dlist_hndl);
+            remote_sides.push_back(dlist_hndl);
+        }
+    }
+
+    if (ret == NIXL_SUCCESS) {
+        std::vector<int> indices(local_descs.descCount());
+        for (int i = 0; i < local_descs.descCount(); ++i)
+            indices[i] = i;
+
+        ret = makeBcastXferReq(prepped.front(), indices, remote_sides, indices,
+                               req_hndl, extra_params);
+    }
+
+    // The request keeps the handles it views into alive
+    for (auto & hndl : prepped)
+        releasedDlistH(hndl);
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::makeGatherXferReq (const nixlDlistH* local_side,
+                              const std::vector<std::vector<int>> &local_indices,
+                              const std::vector<const nixlDlistH*> &remote_sides,
+                              const std::vector<std::vector<int>> &remote_indices,
+                              nixlXferReqH* &req_hndl,
+                              const nixl_opt_args_t* extra_params) const {
+    nixl_opt_args_t part_params;
+    nixl_status_t   ret;
+    NIXL_TRACE_SCOPE("makeGatherXferReq", "nixl", remote_sides.size());
+
+    req_hndl = nullptr;
+
+    if (remote_sides.empty() ||
+        (local_indices.size() != remote_sides.size()) ||
+        (remote_indices.size() != remote_sides.size()))
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (extra_params) {
+        if (!extra_params->segments.empty())
+            return NIXL_ERR_INVALID_PARAM;
+        part_params = *extra_params;
+    }
+
+    // The notification is given by the handle to each part at post time
+    part_params.hasNotif = false;
+    part_params.notifMsg.clear();
+
+    nixlXferReqH* handle = new nixlXferReqH;
+
+    // Each source is a full request, all posted before any is polled,
+    // so the backends have the reads from all the peers in flight
+    for (size_t i = 0; i < remote_sides.size(); ++i) {
+        nixlXferReqH* part;
+
+        ret = makeXferReq(NIXL_READ, local_side, local_indices[i],
+                          remote_sides[i], remote_indices[i], part, &part_params);
+        if (ret != NIXL_SUCCESS) {
+            delete handle;
+            return ret;
+        }
+        handle->peerParts.push_back(part);
+    }
+
+    ret = data->joinPeerParts(handle, NIXL_READ, extra_params);
     if (ret != NIXL_SUCCESS) {
         delete handle;
         return ret;
@@ -607,153 +2403,128 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
 }
 
 nixl_status_t
-nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
-                         const nixl_xfer_dlist_t &local_descs,
-                         const nixl_xfer_dlist_t &remote_descs,
-                         const std::string &remote_agent,
-                         nixlXferReqH* &req_hndl,
-                         const nixl_opt_args_t* extra_params) const {
-    nixl_status_t     ret1, ret2;
-    nixl_opt_b_args_t opt_args;
-    backend_set_t*    backend_set = new backend_set_t();
+nixlAgent::createGatherXferReq (const std::vector<nixl_xfer_dlist_t> &local_descs,
+                                const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                                const std::vector<std::string> &remote_agents,
+                                nixlXferReqH* &req_hndl,
+                                const nixl_opt_args_t* extra_params) const {
+    std::vector<std::vector<int>>  indices;
+    std::vector<const nixlDlistH*> remote_sides;
+    std::vector<nixlDlistH*>       prepped;
+    nixlDlistH*                    dlist_hndl;
+    nixl_status_t                  ret;
 
     req_hndl = nullptr;
 
-    if (data->remoteSections.count(remote_agent) == 0)
-        return NIXL_ERR_NOT_FOUND;
-
-    // Check the correspondence between descriptor lists
-    if (local_descs.descCount() != remote_descs.descCount())
+    if (remote_descs.empty() || (remote_descs.size() != remote_agents.size()) ||
+        (local_descs.size() != remote_descs.size()))
         return NIXL_ERR_INVALID_PARAM;
-    for (int i=0; i<local_descs.descCount(); ++i)
-        if (local_descs[i].len != remote_descs[i].len)
-            return NIXL_ERR_INVALID_PARAM;
 
-    if (!extra_params || extra_params->backends.size() == 0) {
-        // Finding backends that support the corresponding memories
-        // locally and remotely, and find the common ones.
-        backend_set_t* local_set =
-            data->memorySection->queryBackends(local_descs.getType());
-        backend_set_t* remote_set =
-            data->remoteSections[remote_agent]->queryBackends(
-                                                remote_descs.getType());
-        if (!local_set || !remote_set) {
-            delete backend_set;
-            return NIXL_ERR_NOT_FOUND;
-        }
-
-        for (auto & elm : *local_set)
-            if (remote_set->count(elm) != 0)
-                backend_set->insert(elm);
+    // The local lists are prepared once, as a single list
+    nixl_xfer_dlist_t all_local(local_descs.front().getType());
+    for (auto & descs : local_descs) {
+        if (descs.getType() != all_local.getType())
+            return NIXL_ERR_INVALID_PARAM;
 
-        if (backend_set->empty()) {
-            delete backend_set;
-            return NIXL_ERR_NOT_FOUND;
+        indices.emplace_back();
+        for (int i = 0; i < descs.descCount(); ++i) {
+            indices.back().push_back(all_local.descCount());
+            all_local.addDesc(descs[i]);
         }
-    } else {
-        for (auto & elm : extra_params->backends)
-            backend_set->insert(elm->engine);
     }
 
-    // TODO: when central KV is supported, add a call to fetchRemoteMD
-    // TODO: merge descriptors back to back in memory (like makeXferReq).
-    // TODO [Perf]: Avoid heap allocation on the datapath, maybe use a mem pool
-
-    nixlXferReqH *handle   = new nixlXferReqH;
-    handle->initiatorDescs = new nixl_meta_dlist_t (
-                                     local_descs.getType(),
-                                     local_descs.isSorted());
-
-    handle->targetDescs    = new nixl_meta_dlist_t (
-                                     remote_descs.getType(),
-                                     remote_descs.isSorted());
-
-    // Currently we loop through and find first local match. Can use a
-    // preference list or more exhaustive search.
-    for (auto & backend : *backend_set) {
-        // If populate fails, it clears the resp before return
-        ret1 = data->memorySection->populate(
-                     local_descs, backend, *handle->initiatorDescs);
-        ret2 = data->remoteSections[remote_agent]->populate(
-                     remote_descs, backend, *handle->targetDescs);
+    ret = prepXferDlist(NIXL_INIT_AGENT, all_local, dlist_hndl, extra_params);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+    prepped.push_back(dlist_hndl);
 
-        if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS)) {
-            // For Logging:
-            // std::cout << "Selected backend: " << backend->getType() << "\n";
-            handle->engine = backend;
-            break;
+    for (size_t i = 0; (i < remote_descs.size()) && (ret == NIXL_SUCCESS); ++i) {
+        ret = prepXferDlist(remote_agents[i], remote_descs[i], dlist_hndl,
+                            extra_params);
+        if (ret == NIXL_SUCCESS) {
+            prepped.push_back(dlist_hndl);
+            remote_sides.push_back(dlist_hndl);
         }
     }
 
-    delete backend_set;
-
-    if (!handle->engine) {
-        delete handle;
-        return NIXL_ERR_NOT_FOUND;
-    }
-
-    if (extra_params && extra_params->hasNotif) {
-        opt_args.notifMsg = extra_params->notifMsg;
-        opt_args.hasNotif = true;
-    }
-
-    if (opt_args.hasNotif && (!handle->engine->supportsNotif())) {
-        delete handle;
-        return NIXL_ERR_BACKEND;
-    }
-
-    handle->remoteAgent = remote_agent;
-    handle->backendOp   = operation;
-    handle->status      = NIXL_ERR_NOT_POSTED;
-    handle->notifMsg    = opt_args.notifMsg;
-    handle->hasNotif    = opt_args.hasNotif;
+    if (ret == NIXL_SUCCESS) {
+        std::vector<std::vector<int>> remote_indices;
+        for (auto & descs : remote_descs) {
+            remote_indices.emplace_back(descs.descCount());
+            for (int i = 0; i < descs.descCount(); ++i)
+                remote_indices.back()[i] = i;
+        }
 
-    ret1 = handle->engine->prepXfer (handle->backendOp,
-                                     *handle->initiatorDescs,
-                                     *handle->targetDescs,
-                                     handle->remoteAgent,
-                                     handle->backendHandle,
-                                     &opt_args);
-    if (ret1 != NIXL_SUCCESS) {
-        delete handle;
-        return ret1;
+        ret = makeGatherXferReq(prepped.front(), indices, remote_sides,
+                                remote_indices, req_hndl, extra_params);
     }
 
-    req_hndl = handle;
-    return NIXL_SUCCESS;
+    // The request keeps the handles it views into alive
+    for (auto & hndl : prepped)
+        releasedDlistH(hndl);
+    return ret;
 }
 
 nixl_status_t
 nixlAgent::postXferReq(nixlXferReqH *req_hndl,
                        const nixl_opt_args_t* extra_params) const {
-    nixl_status_t ret;
     nixl_opt_b_args_t opt_args;
+    NIXL_TRACE_SCOPE("postXferReq", "nixl");
 
     opt_args.hasNotif = false;
 
     if (!req_hndl)
         return NIXL_ERR_INVALID_PARAM;
 
+    // Its backend handle was given up, so it can only be released,
+    // or its segments are posted by a stream
+    if (req_hndl->canceled || req_hndl->stream)
+        return NIXL_ERR_NOT_ALLOWED;
+
+    if (!data->canceledReqs.empty())
+        data->retryCanceled();
+
+    if (!data->openBatches.empty())
+        data->flushBatches();
+
     // Check if the remote was invalidated before post/repost
-    if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
+    if (data->remoteRemoved(req_hndl)) {
         delete req_hndl;
         return NIXL_ERR_NOT_FOUND;
     }
 
     // We can't repost while a request is in progress
     if (req_hndl->status == NIXL_IN_PROG) {
-        req_hndl->status = req_hndl->engine->checkXfer(
-                                     req_hndl->backendHandle);
+        req_hndl->status = data->checkXfer(req_hndl);
         if (req_hndl->status == NIXL_IN_PROG) {
             delete req_hndl;
             return NIXL_ERR_REPOST_ACTIVE;
         }
+        req_hndl->recordDone(req_hndl->status);
     }
 
-    // We CAN repost a previous request that is completed
-    if (req_hndl->status == NIXL_SUCCESS && req_hndl->backendHandle)
-        req_hndl->status = req_hndl->engine->releaseReqH(
-                                     req_hndl->backendHandle);
+    bool chained = extra_params && !extra_params->dependsOn.empty();
+    if (chained) {
+        for (auto & dep : extra_params->dependsOn)
+            if (!dep || (dep == req_hndl) || dep->canceled ||
+                ((dep->status != NIXL_IN_PROG) && (dep->status != NIXL_SUCCESS)))
+                return NIXL_ERR_INVALID_PARAM;
+        data->createSched();
+    }
+
+    if (data->sched) {
+        if (!req_hndl->sched)
+            data->initXferSched(req_hndl);
+        data->sched->charge(req_hndl);
+
+        // Rejected before any change, so it can be posted again as is
+        if (data->sched->mustReject(req_hndl))
+            return NIXL_ERR_OVER_LIMIT;
+    }
+
+    // Its completed backend handle is released right before the post
+    bool release_done = (req_hndl->status == NIXL_SUCCESS) &&
+                        req_hndl->backendHandle;
 
     // Carrying over notification from xfer handle creation time
     if (req_hndl->hasNotif) {
@@ -779,34 +2550,185 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         return NIXL_ERR_BACKEND;
     }
 
+    if (extra_params && extra_params->timeoutUs)
+        req_hndl->timeout = extra_params->timeoutUs;
+    req_hndl->deadline = req_hndl->timeout ?
+                         nixlTime::getUs() + req_hndl->timeout : 0;
+    req_hndl->traced = nixlTrace::isEnabled();
+    if (data->telemetry || req_hndl->traced)
+        req_hndl->postTime = nixlTime::getNs();
+    if (req_hndl->peerStats)
+        req_hndl->peerStats->addPost();
+    if (req_hndl->backendStats)
+        req_hndl->backendStats->addPost();
+
+    if (chained) {
+        // Dependencies posted before the scheduler existed are not tracked,
+        // but have to be polled for the chained post to start
+        for (auto & dep : extra_params->dependsOn) {
+            if ((dep->status == NIXL_IN_PROG) && !dep->sched) {
+                data->initXferSched(dep);
+                data->sched->addInflight(dep);
+            }
+        }
+
+        if (data->sched->wait(req_hndl, extra_params->dependsOn)) {
+            req_hndl->heldRelease = release_done;
+            req_hndl->status      = NIXL_IN_PROG;
+            return NIXL_IN_PROG;
+        }
+    }
+
+    // Low priority posts wait behind the traffic in progress, and posts
+    // over the limits of their peer or backends till they are within them
+    if (data->sched && data->sched->mustHold(req_hndl)) {
+        req_hndl->heldRelease = release_done;
+        req_hndl->status      = NIXL_IN_PROG;
+        data->sched->hold(req_hndl);
+        return NIXL_IN_PROG;
+    }
+
     // If status is not NIXL_IN_PROG we can repost,
-    ret = req_hndl->engine->postXfer (req_hndl->backendOp,
-                                     *req_hndl->initiatorDescs,
-                                     *req_hndl->targetDescs,
-                                      req_hndl->remoteAgent,
-                                      req_hndl->backendHandle,
-                                      &opt_args);
-    req_hndl->status = ret;
-    return ret;
+    opt_args.priority = req_hndl->priority;
+    return data->startXfer(req_hndl, opt_args, release_done);
 }
 
 nixl_status_t
 nixlAgent::getXferStatus (nixlXferReqH *req_hndl) {
 
-    // If the status is done, no need to recheck.
-    if (req_hndl->status != NIXL_SUCCESS) {
+    if (data->sched && data->sched->hasHeld())
+        data->dispatchHeld();
+
+    if (!data->openBatches.empty())
+        data->flushBatches();
+
+    // If the status is done or it was canceled, no need to recheck.
+    // A chained post that was not started has no backend handle either.
+    if ((req_hndl->status != NIXL_SUCCESS) && !req_hndl->canceled &&
+        (req_hndl->status != NIXL_ERR_NOT_POSTED)) {
         // Check if the remote was invalidated before completion
-        if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
+        if (data->remoteRemoved(req_hndl)) {
             delete req_hndl;
             return NIXL_ERR_NOT_FOUND;
         }
-        req_hndl->status = req_hndl->engine->checkXfer(
-                                     req_hndl->backendHandle);
+        bool in_prog = (req_hndl->status == NIXL_IN_PROG);
+
+        req_hndl->status = data->checkXfer(req_hndl);
+        data->expireXfer(req_hndl, nixlTime::getUs());
+
+        bool chained = !req_hndl->dependents.empty();
+        if (in_prog)
+            req_hndl->recordDone(req_hndl->status);
+
+        // Start the posts chained after it right away
+        if (chained && (req_hndl->status != NIXL_IN_PROG))
+            data->dispatchHeld();
     }
 
     return req_hndl->status;
 }
 
+static inline uint64_t viewBytes(const nixl_meta_dview_t &view) {
+    uint64_t bytes = 0;
+    for (int i = 0; i < view.descCount(); ++i)
+        bytes += view[i].len;
+    return bytes;
+}
+
+nixl_status_t
+nixlAgent::getXferProgress (nixlXferReqH *req_hndl,
+                            nixl_xfer_progress_t &progress) {
+    if (!req_hndl)
+        return NIXL_ERR_INVALID_PARAM;
+
+    // getXferStatus deletes the request if its remote was invalidated
+    bool removed = data->remoteRemoved(req_hndl);
+    nixl_status_t ret = getXferStatus(req_hndl);
+    if (removed && (ret == NIXL_ERR_NOT_FOUND))
+        return ret;
+
+    progress.doneBytes  = 0;
+    progress.totalBytes = 0;
+    progress.segmentsDone.clear();
+
+    if (!req_hndl->hasParts()) {
+        progress.totalBytes = viewBytes(req_hndl->initiatorView);
+        if (ret == NIXL_SUCCESS)
+            progress.doneBytes = progress.totalBytes;
+        progress.segmentsDone.push_back(ret == NIXL_SUCCESS);
+        return ret;
+    }
+
+    // Statuses of the parts are from the previous post till they are posted
+    bool posted = (ret == NIXL_IN_PROG) && !req_hndl->held;
+
+    for (auto & part : req_hndl->parts()) {
+        uint64_t bytes = viewBytes(part->initiatorView);
+        bool     done  = (ret == NIXL_SUCCESS) ||
+                         (posted && (part->status == NIXL_SUCCESS));
+
+        progress.totalBytes += bytes;
+        if (done)
+            progress.doneBytes += bytes;
+        if (!req_hndl->segments.empty())
+            progress.segmentsDone.push_back(done);
+    }
+
+    if (req_hndl->segments.empty())
+        progress.segmentsDone.push_back(ret == NIXL_SUCCESS);
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::cancelXferReq (nixlXferReqH *req_hndl) {
+    if (!req_hndl)
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (!data->canceledReqs.empty())
+        data->retryCanceled();
+
+    if (req_hndl->canceled)
+        return NIXL_SUCCESS;
+
+    if (req_hndl->status != NIXL_IN_PROG)
+        return NIXL_SUCCESS;
+
+    // A completed or failed transfer has nothing to abort
+    req_hndl->status = data->checkXfer(req_hndl);
+    if (req_hndl->status != NIXL_IN_PROG) {
+        req_hndl->recordDone(req_hndl->status);
+        return NIXL_SUCCESS;
+    }
+
+    data->cancelXfer(req_hndl);
+    req_hndl->canceled      = true;
+    req_hndl->status        = NIXL_ERR_NOT_POSTED;
+    req_hndl->recordDone(NIXL_ERR_NOT_POSTED);
+    return NIXL_SUCCESS;
+}
+
+
+nixl_status_t
+nixlAgent::setPeerLimits(const std::string &remote_agent,
+                         const nixl_xfer_limits_t &limits) {
+    if (remote_agent.empty())
+        return NIXL_ERR_INVALID_PARAM;
+
+    data->createSched();
+    data->sched->setPeerLimits(data->getAgentId(remote_agent), limits);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::setBackendLimits(const nixlBackendH* backend,
+                            const nixl_xfer_limits_t &limits) {
+    if (!backend)
+        return NIXL_ERR_INVALID_PARAM;
+
+    data->createSched();
+    data->sched->setBackendLimits(backend->engine->getId(), limits);
+    return NIXL_SUCCESS;
+}
 
 nixl_status_t
 nixlAgent::queryXferBackend(const nixlXferReqH* req_hndl,
@@ -818,17 +2740,36 @@ nixlAgent::queryXferBackend(const nixlXferReqH* req_hndl,
 nixl_status_t
 nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) {
 
-    //attempt to cancel request
-    if(req_hndl->status == NIXL_IN_PROG) {
-        req_hndl->status = req_hndl->engine->checkXfer(
-                                     req_hndl->backendHandle);
+    // The stream posting its segments has to be released first
+    if (req_hndl->stream)
+        return NIXL_ERR_NOT_ALLOWED;
 
-        if(req_hndl->status == NIXL_IN_PROG) {
+    //attempt to cancel request
+    // A held post was not given to the backends, destructor drops it
+    if(req_hndl->status == NIXL_IN_PROG && !req_hndl->held) {
+        req_hndl->status = data->checkXfer(req_hndl);
 
-            req_hndl->status = req_hndl->engine->releaseReqH(
-                                         req_hndl->backendHandle);
+        if(req_hndl->status == NIXL_IN_PROG && req_hndl->hasParts()) {
+            if (data->releaseParts(req_hndl) < 0)
+                return NIXL_ERR_REPOST_ACTIVE;
+        } else if(req_hndl->status == NIXL_IN_PROG && req_hndl->batch) {
+            // An open batch just drops it, a posted one is only aborted
+            // if no other request is part of it
+            nixlXferBatch* batch = req_hndl->batch;
+            if (!batch->open) {
+                if (batch->members.size() > 1)
+                    return NIXL_ERR_REPOST_ACTIVE;
+                if (batch->engine->releaseReqH(batch->backendHandle) < 0)
+                    return NIXL_ERR_REPOST_ACTIVE;
+                batch->backendHandle = nullptr;
+            }
+        } else if(req_hndl->status == NIXL_IN_PROG && req_hndl->copyJob) {
+            // The workers are done with it once canceled
+            data->copier->cancel(req_hndl->copyJob);
+        } else if(req_hndl->status == NIXL_IN_PROG) {
 
-            if(req_hndl->status < 0)
+            // Status is kept in progress on failure, for cancelXferReq
+            if(req_hndl->engine->releaseReqH(req_hndl->backendHandle) < 0)
                 return NIXL_ERR_REPOST_ACTIVE;
 
             // just in case the backend doesn't set to NULL on success
@@ -840,9 +2781,197 @@ nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) {
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::createXferStream (nixlXferReqH* req_hndl,
+                             nixlXferStreamH* &stream) const {
+    if (!req_hndl || req_hndl->segments.empty())
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (req_hndl->canceled || req_hndl->stream)
+        return NIXL_ERR_NOT_ALLOWED;
+
+    // The chunks reuse the backend handles of the segments
+    if (req_hndl->status == NIXL_IN_PROG)
+        return NIXL_ERR_REPOST_ACTIVE;
+
+    stream = new nixlXferStreamH(req_hndl);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::postXferChunk (nixlXferStreamH* stream,
+                          const nixl_blob_t &notif_msg) const {
+    nixl_opt_b_args_t opt_args;
+    nixl_status_t     ret;
+    NIXL_TRACE_SCOPE("postXferChunk", "nixl");
+
+    if (!stream)
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (stream->failure < 0)
+        return stream->failure;
+
+    nixlXferReqH* req = stream->req;
+    if (!data->remoteById[req->remoteId])
+        return NIXL_ERR_NOT_FOUND;
+
+    // Start the next round once all the chunks of this one completed
+    if (stream->posted == req->segments.size()) {
+        ret = getXferStreamStatus(stream);
+        if (ret == NIXL_IN_PROG)
+            return NIXL_ERR_REPOST_ACTIVE;
+        if (ret < 0)
+            return ret;
+        stream->posted   = 0;
+        stream->notified = 0;
+    }
+
+    nixlXferReqH*      part = req->segments[stream->posted];
+    const nixl_blob_t &msg  = (notif_msg.empty() && part->hasNotif) ?
+                              part->notifMsg : notif_msg;
+
+    if (!msg.empty() && !part->engine->supportsNotif())
+        return NIXL_ERR_BACKEND;
+
+    // Same as postXferReq, a completed backend handle is released before repost
+    if (part->status == NIXL_SUCCESS && part->backendHandle)
+        part->engine->releaseReqH(part->backendHandle);
+
+    // Carried by the post only if it cannot get ahead of a previous one
+    opt_args.priority = req->priority;
+    if (!msg.empty() && (stream->notified == stream->posted)) {
+        opt_args.notifMsg = msg;
+        opt_args.hasNotif = true;
+        stream->pendingNotifs[stream->posted].clear();
+    } else {
+        stream->pendingNotifs[stream->posted] = msg;
+    }
+
+    if (part->backendStats) {
+        part->postTime = nixlTime::getNs();
+        part->backendStats->addPost();
+    }
+
+    part->status = part->engine->postXfer(part->backendOp,
+                                          part->initiatorView,
+                                          part->targetView,
+                                          part->remoteAgent,
+                                          part->backendHandle,
+                                          &opt_args);
+    part->recordDone(part->status);
+    stream->posted++;
+
+    if (part->status < 0) {
+        stream->failure = part->status;
+        return part->status;
+    }
+
+    if (data->telemetry && opt_args.hasNotif)
+        data->telemetry->addNotifsSent(1);
+
+    return getXferStreamStatus(stream);
+}
+
+nixl_status_t
+nixlAgent::getXferStreamStatus (nixlXferStreamH* stream) const {
+    nixl_status_t ret;
+
+    if (!stream)
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (stream->failure < 0)
+        return stream->failure;
+
+    nixlXferReqH* req = stream->req;
+
+    // In order, a pending notification is sent once all the chunks up to its
+    // own completed, in the same pass as the ones completing together
+    while (stream->notified < stream->posted) {
+        nixlXferReqH* part = req->segments[stream->notified];
+
+        if (part->status == NIXL_IN_PROG) {
+            part->status = part->engine->checkXfer(part->backendHandle);
+            part->recordDone(part->status);
+        }
+
+        if (part->status == NIXL_IN_PROG)
+            return NIXL_IN_PROG;
+
+        if (part->status < 0) {
+            stream->failure = part->status;
+            return part->status;
+        }
+
+        nixl_blob_t &msg = stream->pendingNotifs[stream->notified];
+        if (!msg.empty()) {
+            ret = part->engine->genNotif(part->remoteAgent, msg);
+            if (ret < 0) {
+                stream->failure = ret;
+                return ret;
+            }
+            if (data->telemetry)
+                data->telemetry->addNotifsSent(1);
+            msg.clear();
+        }
+        stream->notified++;
+    }
+
+    return (stream->notified == req->segments.size()) ? NIXL_SUCCESS : NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlAgent::releaseXferStream (nixlXferStreamH* stream) const {
+    if (!stream)
+        return NIXL_ERR_INVALID_PARAM;
+
+    // Chunks in progress are aborted, so the request can be posted again
+    for (auto & part : stream->req->segments) {
+        if (part->status != NIXL_IN_PROG)
+            continue;
+        part->status = part->engine->checkXfer(part->backendHandle);
+        part->recordDone(part->status);
+        if (part->status != NIXL_IN_PROG)
+            continue;
+        if (part->engine->releaseReqH(part->backendHandle) < 0)
+            return NIXL_ERR_REPOST_ACTIVE;
+        part->backendHandle = nullptr;
+        part->status        = NIXL_ERR_NOT_POSTED;
+        part->recordDone(NIXL_ERR_NOT_POSTED);
+    }
+
+    delete stream;
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::releasedDlistH (nixlDlistH* dlist_hndl) const {
-    delete dlist_hndl;
+    // Requests made from this handle without a copy still view into it,
+    // so the last of them to be released will delete it.
+    nixlDlistH::release(dlist_hndl);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getStats (nixl_agent_stats_t &stats) const {
+    if (!data->telemetry)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    data->telemetry->getStats(stats);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::dumpTrace (const std::string &path) const {
+    return nixlTrace::dump(path);
+}
+
+nixl_status_t
+nixlAgent::exportStats (std::string &out,
+                        const nixl_stats_fmt_t &format) const {
+    if (!data->telemetry)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    data->telemetry->exportStats(data->name, format, out);
     return NIXL_SUCCESS;
 }
 
@@ -852,6 +2981,12 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     notif_list_t    bknd_notif_list;
     nixl_status_t   ret, bad_ret=NIXL_SUCCESS;
     backend_list_t* backend_list;
+    nixlTraceSpan   span("getNotifs", "nixl");
+
+    // The agent has no progress thread, so the window of open batches is
+    // also checked here, for initiators that only poll for notifications
+    if (!data->openBatches.empty())
+        data->flushBatches();
 
     if (!extra_params || extra_params->backends.size() == 0) {
         backend_list = &data->notifEngines;
@@ -874,13 +3009,23 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     // the backend to the msg, but user could put it themselves.
     for (auto & eng: *backend_list) {
         bknd_notif_list.clear();
-        ret = eng->getNotifs(bknd_notif_list);
+
+        // Read first while waiting for the acks of packed writes
+        auto held = data->heldNotifs.find(eng);
+        if (held != data->heldNotifs.end()) {
+            bknd_notif_list.swap(held->second);
+            data->heldNotifs.erase(held);
+        }
+
+        ret = data->pollNotifs(eng, bknd_notif_list);
         if (ret < 0)
             bad_ret=ret;
 
         if (bknd_notif_list.size() == 0)
             continue;
 
+        span.setArg(bknd_notif_list.size());
+
         for (auto & elm: bknd_notif_list) {
             if (notif_map.count(elm.first) == 0)
                 notif_map[elm.first] = std::vector<nixl_blob_t>();
@@ -892,6 +3037,15 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     if (extra_params && extra_params->backends.size() > 0)
         delete backend_list;
 
+    // Notifications of the local copies, from the agent itself
+    if (!data->localNotifs.empty()) {
+        if (data->telemetry)
+            data->telemetry->addNotifsReceived(data->localNotifs.size());
+        for (auto & elm: data->localNotifs)
+            notif_map[elm.first].push_back(elm.second);
+        data->localNotifs.clear();
+    }
+
     return bad_ret;
 }
 
@@ -902,6 +3056,7 @@ nixlAgent::genNotif(const std::string &remote_agent,
 
     nixlBackendEngine* backend = nullptr;
     backend_list_t*    backend_list;
+    NIXL_TRACE_SCOPE("genNotif", "nixl", msg.size());
 
     if (!extra_params || extra_params->backends.size() == 0) {
         backend_list = &data->notifEngines;
@@ -930,10 +3085,13 @@ nixlAgent::genNotif(const std::string &remote_agent,
     if (extra_params && extra_params->backends.size() > 0)
         delete backend_list;
 
-    if (backend)
-        return backend->genNotif(remote_agent, msg);
-    else
+    if (!backend)
         return NIXL_ERR_NOT_FOUND;
+
+    nixl_status_t ret = backend->genNotif(remote_agent, msg);
+    if (data->telemetry && (ret == NIXL_SUCCESS))
+        data->telemetry->addNotifsSent(1);
+    return ret;
 }
 
 nixl_status_t
@@ -973,6 +3131,13 @@ nixlAgent::getLocalMD (nixl_blob_t &str) const {
     if(ret)
         return ret;
 
+    // Optional, at the end so agents not knowing it can skip it
+    if (!data->packKey.empty()) {
+        ret = sd.addStr("Pack", data->packKey);
+        if(ret)
+            return ret;
+    }
+
     str = sd.exportStr();
     return NIXL_SUCCESS;
 }
@@ -987,6 +3152,7 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
     nixl_backend_t nixl_backend;
     nixlBackendEngine* eng;
     nixl_status_t ret;
+    NIXL_TRACE_SCOPE("loadRemoteMD", "nixl", remote_metadata.size());
 
     ret = sd.importStr(remote_metadata);
     if(ret)
@@ -1047,9 +3213,13 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
     if (sd.getStr("") != "MemSection")
         return NIXL_ERR_MISMATCH;
 
+    // Reloading the remote section changes the remote populate results
+    if (data->xferCache)
+        data->xferCache->invalidate(remote_agent);
+
     if (data->remoteSections.count(remote_agent) == 0)
-        data->remoteSections[remote_agent] = new nixlRemoteSection(
-                                                  remote_agent);
+        data->setRemoteSection(remote_agent,
+                               new nixlRemoteSection(remote_agent));
 
     ret = data->remoteSections[remote_agent]->loadRemoteData(&sd,
                                                   data->backendEngines);
@@ -1057,10 +3227,17 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
     // TODO: can be more graceful, if just the new MD blob was improper
     if (ret) {
         delete data->remoteSections[remote_agent];
-        data->remoteSections.erase(remote_agent);
+        data->setRemoteSection(remote_agent, nullptr);
         return ret;
     }
 
+    // Writes to it are only packed if it advertised packing
+    std::string pack_key = sd.getStr("Pack");
+    if (pack_key.size() == nixlXferPack::keyLen)
+        data->packPeers[remote_agent] = pack_key;
+    else
+        data->packPeers.erase(remote_agent);
+
     agent_name = remote_agent;
     return NIXL_SUCCESS;
 }
@@ -1070,10 +3247,14 @@ nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
     if (remote_agent == data->name)
         return NIXL_ERR_INVALID_PARAM;
 
+    if (data->xferCache)
+        data->xferCache->invalidate(remote_agent);
+    data->packPeers.erase(remote_agent);
+
     nixl_status_t ret = NIXL_ERR_NOT_FOUND;
     if (data->remoteSections.count(remote_agent)!=0) {
         delete data->remoteSections[remote_agent];
-        data->remoteSections.erase(remote_agent);
+        data->setRemoteSection(remote_agent, nullptr);
         ret = NIXL_SUCCESS;
     }
 
@@ -0,0 +1,167 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstring>
+#include <algorithm>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "local_copy.h"
+
+// Smallest piece given to a worker, below it the queueing costs more than the copy
+static const size_t minPieceBytes = 65536;
+
+// Copies len bytes with streaming stores for the aligned bulk, which bypass
+// the caches, falling back to memcpy for the unaligned ends.
+static void copyNonTemporal(void* dst, const void* src, size_t len) {
+#if defined(__SSE2__)
+    char*       d    = (char*) dst;
+    const char* s    = (const char*) src;
+    size_t      head = (-(uintptr_t) d) & 15;
+
+    if (len < head + 64) {
+        memcpy(dst, src, len);
+        return;
+    }
+
+    memcpy(d, s, head);
+    d   += head;
+    s   += head;
+    len -= head;
+
+    for (; len >= 64; d += 64, s += 64, len -= 64) {
+        __m128i a = _mm_loadu_si128((const __m128i*) s);
+        __m128i b = _mm_loadu_si128((const __m128i*) (s + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*) (s + 32));
+        __m128i e = _mm_loadu_si128((const __m128i*) (s + 48));
+        _mm_stream_si128((__m128i*) d, a);
+        _mm_stream_si128((__m128i*) (d + 16), b);
+        _mm_stream_si128((__m128i*) (d + 32), c);
+        _mm_stream_si128((__m128i*) (d + 48), e);
+    }
+    // Streaming stores are weakly ordered, they have to be visible
+    // before the job is seen as done
+    _mm_sfence();
+
+    memcpy(d, s, len);
+#else
+    memcpy(dst, src, len);
+#endif
+}
+
+/*** nixlCopyJob implementation ***/
+nixlCopyJob::nixlCopyJob(nixlLocalCopier* copier, const nixl_xfer_op_t &op,
+                         const nixl_meta_dview_t &initiator,
+                         const nixl_meta_dview_t &target) : copier(copier) {
+    for (int i = 0; i < initiator.descCount(); ++i) {
+        char* local  = (char*) initiator[i].addr;
+        char* remote = (char*) target[i].addr;
+        char* dst    = (op == NIXL_READ) ? local : remote;
+        char* src    = (op == NIXL_READ) ? remote : local;
+        size_t len   = initiator[i].len;
+
+        for (size_t offset = 0; offset < len; offset += copier->pieceBytes)
+            pieces.push_back({dst + offset, src + offset,
+                              std::min(copier->pieceBytes, len - offset)});
+        totalBytes += len;
+    }
+}
+
+nixlCopyJob::~nixlCopyJob() {
+    copier->cancel(this);
+}
+
+/*** nixlLocalCopier implementation ***/
+nixlLocalCopier::nixlLocalCopier(const size_t &num_threads,
+                                 const size_t &async_bytes) :
+                                     asyncBytes(async_bytes) {
+    // A core is left to the posting thread, without a spare one the copies
+    // are all done within the post
+    size_t cores   = std::thread::hardware_concurrency();
+    size_t threads = std::min(num_threads, (cores > 1) ? cores - 1 : 0);
+
+    pieceBytes = std::max(async_bytes / std::max(threads, (size_t) 1),
+                          minPieceBytes);
+
+    for (size_t i = 0; i < threads; ++i)
+        workers.emplace_back(&nixlLocalCopier::workerLoop, this);
+}
+
+nixlLocalCopier::~nixlLocalCopier() {
+    {
+        std::lock_guard<std::mutex> lk(lock);
+        stop = true;
+    }
+    cv.notify_all();
+    for (auto &t : workers)
+        t.join();
+}
+
+void nixlLocalCopier::workerLoop() {
+    std::unique_lock<std::mutex> lk(lock);
+    while (true) {
+        cv.wait(lk, [&] { return stop || !queue.empty(); });
+        if (stop)
+            return;
+
+        nixlCopyJob* job = queue.front().first;
+        auto &piece      = job->pieces[queue.front().second];
+        queue.pop_front();
+        lk.unlock();
+
+        copyNonTemporal(piece.dst, piece.src, piece.len);
+        // The job can be deleted right after, it is not touched anymore
+        job->remaining.fetch_sub(1, std::memory_order_release);
+
+        lk.lock();
+    }
+}
+
+nixl_status_t nixlLocalCopier::post(nixlCopyJob* job) {
+    if (workers.empty() || (job->totalBytes < asyncBytes)) {
+        for (auto &piece : job->pieces)
+            memcpy(piece.dst, piece.src, piece.len);
+        return NIXL_SUCCESS;
+    }
+
+    job->remaining.store(job->pieces.size(), std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lk(lock);
+        for (size_t i = 0; i < job->pieces.size(); ++i)
+            queue.emplace_back(job, i);
+    }
+    cv.notify_all();
+    return NIXL_IN_PROG;
+}
+
+void nixlLocalCopier::cancel(nixlCopyJob* job) {
+    if (job->done())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lk(lock);
+        auto it = std::remove_if(queue.begin(), queue.end(),
+                                 [&](const std::pair<nixlCopyJob*, size_t> &elm) {
+                                     return elm.first == job;
+                                 });
+        job->remaining.fetch_sub(queue.end() - it, std::memory_order_relaxed);
+        queue.erase(it, queue.end());
+    }
+
+    // At most one piece per worker is still being copied
+    while (!job->done())
+        std::this_thread::yield();
+}
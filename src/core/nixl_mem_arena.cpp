@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "mem_arena.h"
+
+// From numaif.h, not to depend on libnuma for a single call
+#define NIXL_MPOL_BIND 2
+
+static unsigned int orderOf (const size_t &len) {
+    unsigned int order = 0;
+    while (((size_t) 1 << order) < len)
+        order++;
+    return order;
+}
+
+nixlMemArena::nixlMemArena (const size_t &size, const int &numa_node) {
+    void* addr;
+
+    this->maxOrder = std::max(orderOf(size), arenaOrder);
+    this->size     = (size_t) 1 << maxOrder;
+    this->numaNode = numa_node;
+    this->initErr  = false;
+
+    // Reserved huge pages if the system has enough, otherwise transparent
+    // huge pages are requested for a regular mapping
+    addr = mmap(nullptr, this->size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (addr == MAP_FAILED) {
+        addr = mmap(nullptr, this->size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (addr == MAP_FAILED) {
+            base    = 0;
+            initErr = true;
+            return;
+        }
+        madvise(addr, this->size, MADV_HUGEPAGE);
+    }
+    base = (uintptr_t) addr;
+
+    // Binding before the pages are touched, registration will fault them in
+    if (numa_node >= 0) {
+        std::vector<unsigned long> node_mask(numa_node / (8 * sizeof(long)) + 1, 0);
+        node_mask[numa_node / (8 * sizeof(long))] |=
+                                    1UL << (numa_node % (8 * sizeof(long)));
+        if (syscall(SYS_mbind, addr, this->size, NIXL_MPOL_BIND,
+                    node_mask.data(), node_mask.size() * 8 * sizeof(long) + 1,
+                    0) != 0) {
+            munmap(addr, this->size);
+            base    = 0;
+            initErr = true;
+            return;
+        }
+    }
+
+    freeBlocks.resize(maxOrder + 1);
+    freeBlocks[maxOrder].insert(0);
+}
+
+nixlMemArena::~nixlMemArena () {
+    if (base)
+        munmap((void*) base, size);
+}
+
+nixl_status_t nixlMemArena::alloc (const size_t &len, uintptr_t &addr) {
+    unsigned int order = std::max(orderOf(len), minOrder);
+    unsigned int k;
+    size_t offset;
+
+    if (order > maxOrder)
+        return NIXL_ERR_NOT_FOUND;
+
+    for (k = order; (k <= maxOrder) && freeBlocks[k].empty(); ++k);
+    if (k > maxOrder)
+        return NIXL_ERR_NOT_FOUND;
+
+    offset = *freeBlocks[k].begin();
+    freeBlocks[k].erase(freeBlocks[k].begin());
+
+    // Splitting down to the requested order, the upper halves become free
+    while (k > order) {
+        k--;
+        freeBlocks[k].insert(offset + ((size_t) 1 << k));
+    }
+
+    allocated[offset] = order;
+    usedBytes += (size_t) 1 << order;
+    addr = base + offset;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlMemArena::free (const uintptr_t &addr) {
+    if ((addr < base) || (addr >= base + size))
+        return NIXL_ERR_NOT_FOUND;
+
+    auto it = allocated.find(addr - base);
+    if (it == allocated.end())
+        return NIXL_ERR_NOT_FOUND;
+
+    size_t       offset = it->first;
+    unsigned int order  = it->second;
+
+    allocated.erase(it);
+    usedBytes -= (size_t) 1 << order;
+
+    // Merging with the buddy as long as it is free
+    while (order < maxOrder) {
+        size_t buddy = offset ^ ((size_t) 1 << order);
+        auto b_it = freeBlocks[order].find(buddy);
+        if (b_it == freeBlocks[order].end())
+            break;
+        freeBlocks[order].erase(b_it);
+        offset = std::min(offset, buddy);
+        order++;
+    }
+    freeBlocks[order].insert(offset);
+    return NIXL_SUCCESS;
+}
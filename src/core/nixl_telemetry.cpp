@@ -0,0 +1,393 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include "telemetry.h"
+
+uint64_t nixlXferStats::getPercentileNs(const double &pct) const {
+    uint64_t total = 0, seen = 0;
+
+    for (auto & count : latencyBuckets)
+        total += count;
+    if (total == 0)
+        return 0;
+
+    double target = std::min(std::max(pct, 0.0), 100.0) * total / 100;
+
+    for (size_t i = 0; i < latencyBuckets.size(); ++i) {
+        if (latencyBuckets[i] == 0 || (seen + latencyBuckets[i]) < target) {
+            seen += latencyBuckets[i];
+            continue;
+        }
+
+        double low  = (i == 0) ? 0 : (double) ((uint64_t) 1 << i);
+        double high = (double) ((uint64_t) 1 << i) * 2;
+        double frac = (target - seen) / latencyBuckets[i];
+
+        return std::min((uint64_t) (low + frac * (high - low)), maxNs);
+    }
+
+    return maxNs;
+}
+
+void nixlXferCounters::addXfer (const uint64_t &latency_ns,
+                                const uint64_t &bytes,
+                                const uint64_t &descs,
+                                const uint64_t &posted_descs) {
+    // Index of the highest set bit, the power of two bucket of the latency
+    unsigned int bucket = latency_ns ? 63 - __builtin_clzll(latency_ns) : 0;
+
+    xferCount.fetch_add(1, std::memory_order_relaxed);
+    totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+    descCount.fetch_add(descs, std::memory_order_relaxed);
+    postedDescCount.fetch_add(posted_descs, std::memory_order_relaxed);
+    totalNs.fetch_add(latency_ns, std::memory_order_relaxed);
+    latencyBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    // Single writer, so no need for a compare and swap loop
+    if (latency_ns > maxNs.load(std::memory_order_relaxed))
+        maxNs.store(latency_ns, std::memory_order_relaxed);
+}
+
+void nixlXferCounters::read (nixlXferStats &stats) const {
+    stats.postCount       = postCount.load(std::memory_order_relaxed);
+    stats.xferCount       = xferCount.load(std::memory_order_relaxed);
+    stats.errorCount      = errorCount.load(std::memory_order_relaxed);
+    stats.totalBytes      = totalBytes.load(std::memory_order_relaxed);
+    stats.descCount       = descCount.load(std::memory_order_relaxed);
+    stats.postedDescCount = postedDescCount.load(std::memory_order_relaxed);
+    stats.totalNs         = totalNs.load(std::memory_order_relaxed);
+    stats.maxNs           = maxNs.load(std::memory_order_relaxed);
+
+    for (size_t i = 0; i < latencyBuckets.size(); ++i)
+        stats.latencyBuckets[i] = latencyBuckets[i].load(std::memory_order_relaxed);
+}
+
+nixlXferCounters* nixlTelemetry::getPeer (const unsigned int &agent_id,
+                                          const std::string &agent_name,
+                                          const nixl_xfer_op_t &op) {
+    // Only this thread modifies peers, so reading it does not need the lock
+    if ((agent_id >= peers.size()) || !peers[agent_id]) {
+        const std::lock_guard<std::mutex> guard(lock);
+
+        if (agent_id >= peers.size()) {
+            peers.resize(agent_id + 1);
+            peerNames.resize(agent_id + 1);
+        }
+        peers[agent_id]     = std::make_unique<nixl_op_counters_t>();
+        peerNames[agent_id] = agent_name;
+    }
+
+    return &(*peers[agent_id])[op];
+}
+
+void nixlTelemetry::addBackend (const nixlBackendEngine* engine) {
+    const std::lock_guard<std::mutex> guard(lock);
+    engines.push_back(engine);
+}
+
+void nixlTelemetry::getStats (nixl_agent_stats_t &stats) const {
+    const std::lock_guard<std::mutex> guard(lock);
+
+    stats.peers.clear();
+    stats.backends.clear();
+    stats.backendCounters.clear();
+
+    for (size_t i = 0; i < peers.size(); ++i) {
+        if (!peers[i])
+            continue;
+        auto &entry = stats.peers[peerNames[i]];
+        for (int op = NIXL_READ; op <= NIXL_WRITE; ++op)
+            (*peers[i])[op].read(entry[op]);
+    }
+
+    for (auto & engine : engines) {
+        unsigned int id = engine->getId();
+        auto &entry     = stats.backends[engine->getType()];
+        auto &counters  = stats.backendCounters[engine->getType()];
+
+        for (int op = NIXL_READ; op <= NIXL_WRITE; ++op)
+            backends[id][op].read(entry[op]);
+
+        counters["registered_bytes"] = regBytes[id].load(std::memory_order_relaxed);
+        engine->getCounters(counters);
+    }
+
+    stats.notifsSent     = notifsSent.load(std::memory_order_relaxed);
+    stats.notifsReceived = notifsReceived.load(std::memory_order_relaxed);
+}
+
+/*** Export formats ***/
+
+static const char* opNames[] = {"READ", "WRITE"};
+
+// Escapes a Prometheus label value or a JSON string
+static std::string escapeStr (const std::string &str) {
+    std::string out;
+
+    for (auto & c : str) {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        if (c == '\n')
+            out += "\\n";
+        else
+            out += c;
+    }
+    return out;
+}
+
+typedef std::map<std::string, std::array<nixlXferStats, 2>> op_stats_map_t;
+
+// Prometheus name and JSON name (as in the Python getStats) of each counter
+typedef struct {
+    const char*              name;
+    const char*              jsonName;
+    const char*              type;
+    const char*              help;
+    uint64_t nixlXferStats::*field;
+} prom_xfer_metric_t;
+
+static const prom_xfer_metric_t promXferMetrics[] = {
+    {"posted_total",       "post_count",        "counter",
+     "Transfers posted",                                &nixlXferStats::postCount},
+    {"completed_total",    "xfer_count",        "counter",
+     "Transfers completed successfully",                &nixlXferStats::xferCount},
+    {"errors_total",       "error_count",       "counter",
+     "Transfers failed, timed out or canceled",         &nixlXferStats::errorCount},
+    {"bytes_total",        "total_bytes",       "counter",
+     "Bytes of the successful transfers",               &nixlXferStats::totalBytes},
+    {"descs_total",        "desc_count",        "counter",
+     "Descriptors given for the successful transfers",  &nixlXferStats::descCount},
+    {"posted_descs_total", "posted_desc_count", "counter",
+     "Descriptors posted to the backend after merging", &nixlXferStats::postedDescCount},
+};
+
+static uint64_t inFlight (const nixlXferStats &st) {
+    uint64_t done = st.xferCount + st.errorCount;
+    // Counters are read one by one, so a completion might be seen before its post
+    return (st.postCount > done) ? st.postCount - done : 0;
+}
+
+static void promHeader (std::string &out, const std::string &name,
+                        const char* type, const char* help) {
+    out += "# HELP " + name + " " + help + "\n";
+    out += "# TYPE " + name + " " + type + "\n";
+}
+
+// Transfer metrics of all the peers or backends, grouped per metric family
+static void promXferStats (std::string &out, const op_stats_map_t &stats,
+                           const std::string &prefix, const std::string &key,
+                           const std::string &agent_label) {
+    char num[32];
+
+    if (stats.empty())
+        return;
+
+    for (auto & metric : promXferMetrics) {
+        std::string name = prefix + metric.name;
+        promHeader(out, name, metric.type, metric.help);
+        for (auto & elm : stats)
+            for (int op = NIXL_READ; op <= NIXL_WRITE; ++op)
+                out += name + "{" + agent_label + "," + key + "=\"" +
+                       escapeStr(elm.first) + "\",op=\"" + opNames[op] + "\"} " +
+                       std::to_string(elm.second[op].*metric.field) + "\n";
+    }
+
+    promHeader(out, prefix + "in_flight", "gauge", "Transfers posted and not done");
+    for (auto & elm : stats)
+        for (int op = NIXL_READ; op <= NIXL_WRITE; ++op)
+            out += prefix + "in_flight{" + agent_label + "," + key + "=\"" +
+                   escapeStr(elm.first) + "\",op=\"" + opNames[op] + "\"} " +
+                   std::to_string(inFlight(elm.second[op])) + "\n";
+
+    std::string name = prefix + "latency_seconds";
+    promHeader(out, name, "histogram",
+               "Latency from post to observed completion of the successful transfers");
+    for (auto & elm : stats) {
+        for (int op = NIXL_READ; op <= NIXL_WRITE; ++op) {
+            const nixlXferStats &st = elm.second[op];
+            std::string labels = agent_label + "," + key + "=\"" +
+                                 escapeStr(elm.first) + "\",op=\"" + opNames[op] + "\"";
+            uint64_t cumulative = 0;
+            int last = -1;
+
+            for (size_t i = 0; i < st.latencyBuckets.size(); ++i)
+                if (st.latencyBuckets[i])
+                    last = i;
+
+            // Buckets are powers of two in ns, up to the largest one used
+            for (int i = 0; i <= last; ++i) {
+                cumulative += st.latencyBuckets[i];
+                snprintf(num, sizeof(num), "%.9g", ((double) ((uint64_t) 1 << i) * 2) / 1e9);
+                out += name + "_bucket{" + labels + ",le=\"" + num + "\"} " +
+                       std::to_string(cumulative) + "\n";
+            }
+            out += name + "_bucket{" + labels + ",le=\"+Inf\"} " +
+                   std::to_string(st.xferCount) + "\n";
+            snprintf(num, sizeof(num), "%.9g", st.totalNs / 1e9);
+            out += name + "_sum{" + labels + "} " + num + "\n";
+            out += name + "_count{" + labels + "} " + std::to_string(st.xferCount) + "\n";
+        }
+    }
+}
+
+static void exportPrometheus (const nixl_agent_stats_t &stats,
+                              const std::string &agent_name, std::string &out) {
+    std::string agent_label = "agent=\"" + escapeStr(agent_name) + "\"";
+
+    promXferStats(out, stats.peers, "nixl_peer_xfer_", "peer", agent_label);
+    promXferStats(out, stats.backends, "nixl_backend_xfer_", "backend", agent_label);
+
+    promHeader(out, "nixl_notifs_sent_total", "counter", "Notifications sent");
+    out += "nixl_notifs_sent_total{" + agent_label + "} " +
+           std::to_string(stats.notifsSent) + "\n";
+    promHeader(out, "nixl_notifs_received_total", "counter", "Notifications received");
+    out += "nixl_notifs_received_total{" + agent_label + "} " +
+           std::to_string(stats.notifsReceived) + "\n";
+
+    // Backend counters are exported untyped, as backends can report either kind
+    std::map<std::string, std::string> families;
+    for (auto & bknd : stats.backendCounters)
+        for (auto & elm : bknd.second)
+            families["nixl_backend_" + elm.first] +=
+                "nixl_backend_" + elm.first + "{" + agent_label + ",backend=\"" +
+                escapeStr(bknd.first) + "\"} " + std::to_string(elm.second) + "\n";
+
+    for (auto & elm : families)
+        out += "# TYPE " + elm.first + " untyped\n" + elm.second;
+}
+
+static void jsonXferStats (std::string &out, const op_stats_map_t &stats) {
+    bool first = true;
+
+    out += "{";
+    for (auto & elm : stats) {
+        out += std::string(first ? "" : ",") + "\"" + escapeStr(elm.first) + "\":{";
+        first = false;
+        for (int op = NIXL_READ; op <= NIXL_WRITE; ++op) {
+            const nixlXferStats &st = elm.second[op];
+            out += std::string(op == NIXL_READ ? "" : ",") + "\"" + opNames[op] + "\":{";
+            for (auto & metric : promXferMetrics)
+                out += "\"" + std::string(metric.jsonName) + "\":" +
+                       std::to_string(st.*metric.field) + ",";
+            out += "\"in_flight\":" + std::to_string(inFlight(st)) +
+                   ",\"total_ns\":" + std::to_string(st.totalNs) +
+                   ",\"max_ns\":" + std::to_string(st.maxNs) +
+                   ",\"p50_ns\":" + std::to_string(st.getPercentileNs(50)) +
+                   ",\"p99_ns\":" + std::to_string(st.getPercentileNs(99)) +
+                   ",\"p999_ns\":" + std::to_string(st.getPercentileNs(99.9)) +
+                   ",\"latency_buckets\":[";
+            for (size_t i = 0; i < st.latencyBuckets.size(); ++i)
+                out += std::string(i ? "," : "") + std::to_string(st.latencyBuckets[i]);
+            out += "]}";
+        }
+        out += "}";
+    }
+    out += "}";
+}
+
+static void exportJson (const nixl_agent_stats_t &stats,
+                        const std::string &agent_name, std::string &out) {
+    bool first = true;
+
+    out += "{\"agent\":\"" + escapeStr(agent_name) + "\",\"peers\":";
+    jsonXferStats(out, stats.peers);
+    out += ",\"backends\":";
+    jsonXferStats(out, stats.backends);
+
+    out += ",\"backend_counters\":{";
+    for (auto & bknd : stats.backendCounters) {
+        out += std::string(first ? "" : ",") + "\"" + escapeStr(bknd.first) + "\":{";
+        first = false;
+        for (auto it = bknd.second.begin(); it != bknd.second.end(); ++it)
+            out += std::string(it == bknd.second.begin() ? "" : ",") + "\"" +
+                   escapeStr(it->first) + "\":" + std::to_string(it->second);
+        out += "}";
+    }
+    out += "},\"notifs_sent\":" + std::to_string(stats.notifsSent) +
+           ",\"notifs_received\":" + std::to_string(stats.notifsReceived) + "}\n";
+}
+
+void nixlTelemetry::exportStats (const std::string &agent_name,
+                                 const nixl_stats_fmt_t &format,
+                                 std::string &out) const {
+    nixl_agent_stats_t stats;
+
+    getStats(stats);
+    out.clear();
+
+    if (format == NIXL_STATS_JSON)
+        exportJson(stats, agent_name, out);
+    else
+        exportPrometheus(stats, agent_name, out);
+}
+
+/*** Exporter thread ***/
+
+nixlStatsExporter::nixlStatsExporter (const nixlTelemetry* telemetry,
+                                      const std::string &agent_name,
+                                      const std::string &path,
+                                      const uint64_t &period_us,
+                                      const nixl_stats_fmt_t &format) :
+                                      telemetry(telemetry), agentName(agent_name),
+                                      path(path), periodUs(period_us),
+                                      format(format) {
+    worker = std::thread(&nixlStatsExporter::run, this);
+}
+
+nixlStatsExporter::~nixlStatsExporter () {
+    {
+        const std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+    }
+    cond.notify_one();
+    worker.join();
+
+    // Final values, e.g., for a short lived process
+    write();
+}
+
+void nixlStatsExporter::run () {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (!cond.wait_for(guard, std::chrono::microseconds(periodUs),
+                          [this] { return stop; })) {
+        guard.unlock();
+        write();
+        guard.lock();
+    }
+}
+
+nixl_status_t nixlStatsExporter::write () const {
+    std::string text;
+    std::string tmp_path = path + ".tmp";
+
+    telemetry->exportStats(agentName, format, text);
+
+    std::ofstream file(tmp_path, std::ios::out | std::ios::trunc);
+    if (!file)
+        return NIXL_ERR_BACKEND;
+    file << text;
+    file.close();
+    if (!file)
+        return NIXL_ERR_BACKEND;
+
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        return NIXL_ERR_BACKEND;
+    return NIXL_SUCCESS;
+}
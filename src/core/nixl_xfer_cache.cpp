@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "xfer_cache.h"
+#include "backend/backend_engine.h"
+#include "transfer_request.h"
+#include "agent_data.h"
+
+// Fast combining of 64-bit words, collisions are resolved by comparing the
+// descriptor lists on lookup, so no need for a cryptographic quality hash.
+static inline uint64_t hashCombine(uint64_t hash, uint64_t value) {
+    hash ^= value;
+    hash *= 0x9e3779b97f4a7c15ULL;
+    return hash ^ (hash >> 32);
+}
+
+static inline uint64_t hashDescList(uint64_t hash,
+                                    const nixl_xfer_dlist_t &d_list) {
+    hash = hashCombine(hash, d_list.getType());
+    hash = hashCombine(hash, d_list.descCount());
+    for (auto & desc : d_list) {
+        hash = hashCombine(hash, desc.addr);
+        hash = hashCombine(hash, desc.len);
+        hash = hashCombine(hash, desc.devId);
+    }
+    return hash;
+}
+
+nixlXferCache::nixlXferCache (const size_t &capacity) {
+    this->capacity = capacity;
+}
+
+nixlXferCache::~nixlXferCache () {
+    invalidate();
+}
+
+uint64_t nixlXferCache::getHash (const nixl_xfer_dlist_t &local_descs,
+                                 const nixl_xfer_dlist_t &remote_descs,
+                                 const std::string &remote_agent,
+                                 const nixl_opt_args_t* extra_params) {
+    uint64_t hash = std::hash<std::string>{}(remote_agent);
+
+    hash = hashDescList(hash, local_descs);
+    hash = hashDescList(hash, remote_descs);
+    if (extra_params)
+        for (auto & elm : extra_params->backends)
+            hash = hashCombine(hash, (uintptr_t) elm->engine);
+    return hash;
+}
+
+void nixlXferCache::evict (entry_list_t::iterator it) {
+    // Requests made from the handles keep them alive if still in use
+    nixlDlistH::release(it->localSide);
+    nixlDlistH::release(it->remoteSide);
+    entryMap.erase(it->hash);
+    entries.erase(it);
+}
+
+bool nixlXferCache::lookup (const uint64_t &hash,
+                            const nixl_xfer_dlist_t &local_descs,
+                            const nixl_xfer_dlist_t &remote_descs,
+                            const std::string &remote_agent,
+                            const nixl_opt_args_t* extra_params,
+                            nixlDlistH* &local_side,
+                            nixlDlistH* &remote_side,
+                            const std::vector<int>* &indices) {
+    auto map_it = entryMap.find(hash);
+    if (map_it == entryMap.end())
+        return false;
+
+    entry_list_t::iterator it = map_it->second;
+    if ((it->remoteAgent != remote_agent) ||
+        !(it->localDescs == local_descs) ||
+        !(it->remoteDescs == remote_descs))
+        return false;
+
+    size_t count = extra_params ? extra_params->backends.size() : 0;
+    if (it->backends.size() != count)
+        return false;
+    for (size_t i=0; i<count; ++i)
+        if (it->backends[i] != extra_params->backends[i]->engine)
+            return false;
+
+    // Move to the front as the most recently used
+    entries.splice(entries.begin(), entries, it);
+
+    local_side  = it->localSide;
+    remote_side = it->remoteSide;
+    indices     = &it->indices;
+    return true;
+}
+
+const std::vector<int>*
+nixlXferCache::insert (const uint64_t &hash,
+                       const nixl_xfer_dlist_t &local_descs,
+                       const nixl_xfer_dlist_t &remote_descs,
+                       const std::string &remote_agent,
+                       const nixl_opt_args_t* extra_params,
+                       nixlDlistH* local_side,
+                       nixlDlistH* remote_side) {
+    // A hash collision replaces the older entry
+    auto map_it = entryMap.find(hash);
+    if (map_it != entryMap.end())
+        evict(map_it->second);
+    else if (entries.size() >= capacity)
+        evict(std::prev(entries.end()));
+
+    entries.emplace_front(local_descs, remote_descs);
+    nixlXferCacheEntry &entry = entries.front();
+
+    entry.hash        = hash;
+    entry.remoteAgent = remote_agent;
+    entry.localSide   = local_side;
+    entry.remoteSide  = remote_side;
+    if (extra_params)
+        for (auto & elm : extra_params->backends)
+            entry.backends.push_back(elm->engine);
+
+    entry.indices.resize(local_descs.descCount());
+    for (int i=0; i<local_descs.descCount(); ++i)
+        entry.indices[i] = i;
+
+    entryMap[hash] = entries.begin();
+    return &entry.indices;
+}
+
+void nixlXferCache::invalidate () {
+    while (!entries.empty())
+        evict(entries.begin());
+}
+
+void nixlXferCache::invalidate (const std::string &remote_agent) {
+    auto it = entries.begin();
+    while (it != entries.end()) {
+        auto next = std::next(it);
+        if (it->remoteAgent == remote_agent)
+            evict(it);
+        it = next;
+    }
+}
@@ -0,0 +1,241 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstddef>
+#include <cstring>
+#include <random>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "xfer_pack.h"
+
+// Header of the layout, followed by an (addr, len, devId) entry per
+// destination descriptor, and the ack of its scatter. Both carry the key
+// of their receiver. Both agents are expected to share endianness.
+static const char packMagic[8] = {'N', 'I', 'X', 'L', 'P', 'A', 'C', 'K'};
+static const char ackMagic[8]  = {'N', 'I', 'X', 'L', 'P', 'A', 'C', 'A'};
+
+struct nixlPackHdr {
+    char     magic[8];
+    char     key[nixlXferPack::keyLen];
+    char     ackKey[nixlXferPack::keyLen];
+    uint64_t seq;
+    uint64_t stagingAddr;
+    uint64_t stagingLen;
+    uint64_t descCount;
+    uint64_t hasNotif;
+};
+
+struct nixlPackEntry {
+    uint64_t addr;
+    uint64_t len;
+    uint64_t devId;
+};
+
+struct nixlPackAck {
+    char     magic[8];
+    char     key[nixlXferPack::keyLen];
+    uint64_t seq;
+    int64_t  status;
+};
+
+static bool hasPrefix(const nixl_blob_t &msg, const size_t &min_len,
+                      const char* magic, const std::string &key) {
+    return (key.size() == nixlXferPack::keyLen) && (msg.size() >= min_len) &&
+           (memcmp(msg.data(), magic, sizeof(packMagic)) == 0) &&
+           (memcmp(msg.data() + sizeof(packMagic), key.data(), key.size()) == 0);
+}
+
+// Small copies are inlined with unaligned vector moves, which is cheaper
+// than a memcpy call for the sizes packing is used for
+static inline void copySmall(char* dst, const char* src, size_t len) {
+#if defined(__SSE2__)
+    for (; len >= 64; dst += 64, src += 64, len -= 64) {
+        __m128i a = _mm_loadu_si128((const __m128i*) src);
+        __m128i b = _mm_loadu_si128((const __m128i*) (src + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*) (src + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*) (src + 48));
+        _mm_storeu_si128((__m128i*) dst, a);
+        _mm_storeu_si128((__m128i*) (dst + 16), b);
+        _mm_storeu_si128((__m128i*) (dst + 32), c);
+        _mm_storeu_si128((__m128i*) (dst + 48), d);
+    }
+    for (; len >= 16; dst += 16, src += 16, len -= 16)
+        _mm_storeu_si128((__m128i*) dst,
+                         _mm_loadu_si128((const __m128i*) src));
+#endif
+    memcpy(dst, src, len);
+}
+
+nixlXferPack::nixlXferPack(const nixl_meta_dview_t &target,
+                           const uintptr_t &remote_staging,
+                           const std::string &remote_key,
+                           const std::string &local_key,
+                           nixl_pack_waits_t &waits) :
+                               localStaging(DRAM_SEG), remoteStaging(DRAM_SEG),
+                               waits(waits) {
+    nixlPackHdr hdr;
+    uint64_t    total = 0;
+
+    layout.resize(sizeof(hdr) + target.descCount() * sizeof(nixlPackEntry));
+    char* out = &layout[sizeof(hdr)];
+
+    for (int i = 0; i < target.descCount(); ++i) {
+        nixlPackEntry entry = {target[i].addr, target[i].len, target[i].devId};
+        memcpy(out, &entry, sizeof(entry));
+        out   += sizeof(entry);
+        total += target[i].len;
+    }
+
+    memcpy(hdr.magic, packMagic, sizeof(packMagic));
+    memcpy(hdr.key, remote_key.data(), keyLen);
+    memcpy(hdr.ackKey, local_key.data(), keyLen);
+    hdr.seq         = 0;
+    hdr.stagingAddr = remote_staging;
+    hdr.stagingLen  = total;
+    hdr.descCount   = target.descCount();
+    hdr.hasNotif    = 0;
+    memcpy(&layout[0], &hdr, sizeof(hdr));
+}
+
+nixlXferPack::~nixlXferPack() {
+    drop();
+}
+
+void nixlXferPack::gather(const nixl_meta_dview_t &initiator) const {
+    char* out = (char*) localStaging[0].addr;
+
+    for (int i = 0; i < initiator.descCount(); ++i) {
+        copySmall(out, (const char*) initiator[i].addr, initiator[i].len);
+        out += initiator[i].len;
+    }
+}
+
+nixl_blob_t nixlXferPack::post(const uint64_t &new_seq, const bool &has_notif,
+                               const nixl_blob_t &msg) {
+    nixl_blob_t out  = layout;
+    uint64_t    flag = has_notif;
+
+    drop();
+    seq       = new_seq;
+    waiting   = true;
+    sent      = false;
+    ackStatus = NIXL_IN_PROG;
+    waits[seq] = this;
+
+    memcpy(&out[offsetof(nixlPackHdr, seq)], &seq, sizeof(seq));
+    memcpy(&out[offsetof(nixlPackHdr, hasNotif)], &flag, sizeof(flag));
+    if (has_notif)
+        out += msg;
+    return out;
+}
+
+void nixlXferPack::drop() {
+    if (waiting)
+        waits.erase(seq);
+    waiting = false;
+}
+
+std::string nixlXferPack::makeKey() {
+    std::random_device rd;
+    std::string        key(keyLen, 0);
+
+    for (size_t i = 0; i < keyLen; i += sizeof(uint32_t)) {
+        uint32_t val = rd();
+        memcpy(&key[i], &val, sizeof(val));
+    }
+    return key;
+}
+
+bool nixlXferPack::isPacked(const nixl_blob_t &msg, const std::string &key) {
+    return hasPrefix(msg, sizeof(nixlPackHdr), packMagic, key);
+}
+
+bool nixlXferPack::isAck(const nixl_blob_t &msg, const std::string &key) {
+    return hasPrefix(msg, sizeof(nixlPackAck), ackMagic, key) &&
+           (msg.size() == sizeof(nixlPackAck));
+}
+
+nixl_status_t nixlXferPack::parse(nixl_blob_t &msg, nixlBasicDesc &staging,
+                                  nixl_xfer_dlist_t &descs, bool &has_notif,
+                                  std::string &ack_key, uint64_t &ack_seq) {
+    nixlPackHdr   hdr;
+    nixlPackEntry entry;
+    uint64_t      total = 0;
+
+    if (msg.size() < sizeof(hdr))
+        return NIXL_ERR_INVALID_PARAM;
+    memcpy(&hdr, msg.data(), sizeof(hdr));
+
+    size_t entries = msg.size() - sizeof(hdr);
+    if (hdr.descCount > entries / sizeof(entry))
+        return NIXL_ERR_INVALID_PARAM;
+
+    const char* in = msg.data() + sizeof(hdr);
+    descs.resize(hdr.descCount);
+    for (uint64_t i = 0; i < hdr.descCount; ++i) {
+        memcpy(&entry, in, sizeof(entry));
+        in += sizeof(entry);
+        if (entry.len > hdr.stagingLen - total)
+            return NIXL_ERR_INVALID_PARAM;
+        descs[i] = nixlBasicDesc(entry.addr, entry.len, entry.devId);
+        total   += entry.len;
+    }
+    if (total != hdr.stagingLen)
+        return NIXL_ERR_INVALID_PARAM;
+
+    staging   = nixlBasicDesc(hdr.stagingAddr, hdr.stagingLen, 0);
+    has_notif = hdr.hasNotif;
+    ack_key.assign(hdr.ackKey, keyLen);
+    ack_seq   = hdr.seq;
+    msg.erase(0, in - msg.data());
+    return NIXL_SUCCESS;
+}
+
+void nixlXferPack::scatter(const nixlBasicDesc &staging,
+                           const nixl_xfer_dlist_t &descs) {
+    const char* in = (const char*) staging.addr;
+
+    for (int i = 0; i < descs.descCount(); ++i) {
+        copySmall((char*) descs[i].addr, in, descs[i].len);
+        in += descs[i].len;
+    }
+}
+
+nixl_blob_t nixlXferPack::ackMsg(const std::string &key, const uint64_t &ack_seq,
+                                 const nixl_status_t &status) {
+    nixlPackAck ack;
+
+    memcpy(ack.magic, ackMagic, sizeof(ackMagic));
+    memcpy(ack.key, key.data(), keyLen);
+    ack.seq    = ack_seq;
+    ack.status = status;
+    return nixl_blob_t((const char*) &ack, sizeof(ack));
+}
+
+void nixlXferPack::ack(const nixl_blob_t &msg, nixl_pack_waits_t &waits) {
+    nixlPackAck ack;
+    memcpy(&ack, msg.data(), sizeof(ack));
+
+    auto it = waits.find(ack.seq);
+    if (it == waits.end())
+        return;
+
+    nixlXferPack* pack = it->second;
+    pack->ackStatus    = (nixl_status_t) ack.status;
+    pack->waiting      = false;
+    waits.erase(it);
+}
@@ -0,0 +1,251 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include "xfer_sched.h"
+#include "transfer_request.h"
+
+/*** nixlXferLimiter implementation ***/
+nixlXferLimiter::nixlXferLimiter(const nixl_xfer_limits_t &limits) {
+    setLimits(limits);
+}
+
+void nixlXferLimiter::setLimits(const nixl_xfer_limits_t &new_limits) {
+    bool had_rate = limits.rateBytesPerSec;
+
+    limits     = new_limits;
+    lastRefill = nixlTime::getUs();
+    if (!had_rate)
+        tokens = burst();
+    else
+        tokens = std::min(tokens, (double) burst());
+}
+
+bool nixlXferLimiter::canStart(const uint64_t &bytes) {
+    if (limits.maxInflightReqs && (inflightReqs >= limits.maxInflightReqs))
+        return false;
+
+    if (limits.maxInflightBytes && inflightBytes &&
+        (inflightBytes + bytes > limits.maxInflightBytes))
+        return false;
+
+    if (!limits.rateBytesPerSec)
+        return true;
+
+    nixlTime::us_t now = nixlTime::getUs();
+    tokens = std::min((double) burst(), tokens + (now - lastRefill) *
+                                        (limits.rateBytesPerSec / 1e6));
+    lastRefill = now;
+    return tokens >= (double) std::min(bytes, burst());
+}
+
+void nixlXferLimiter::start(const uint64_t &bytes) {
+    inflightBytes += bytes;
+    inflightReqs++;
+    if (limits.rateBytesPerSec)
+        tokens -= bytes;
+}
+
+void nixlXferLimiter::done(const uint64_t &bytes) {
+    inflightBytes -= bytes;
+    inflightReqs--;
+}
+
+/*** nixlXferSched implementation ***/
+nixlXferSched::nixlXferSched(const uint64_t &max_inflight_bytes,
+                             const nixl_xfer_limits_t &peer_default) :
+                             maxInflightBytes(max_inflight_bytes),
+                             peerDefault(peer_default) {
+    hasPeerDefault = hasXferLimits(peer_default);
+    hasLimiters    = hasPeerDefault;
+}
+
+nixlXferSched::~nixlXferSched() {
+    for (auto & limiter : peerLimiters)
+        delete limiter;
+    for (auto & limiter : backendLimiters)
+        delete limiter;
+}
+
+nixlXferLimiter* nixlXferSched::peerLimiter(const unsigned int &remote_id) {
+    if (remote_id >= peerLimiters.size())
+        peerLimiters.resize(remote_id + 1, nullptr);
+    if (!peerLimiters[remote_id] && hasPeerDefault)
+        peerLimiters[remote_id] = new nixlXferLimiter(peerDefault);
+    return peerLimiters[remote_id];
+}
+
+void nixlXferSched::setPeerLimits(const unsigned int &remote_id,
+                                  const nixl_xfer_limits_t &limits) {
+    nixlXferLimiter* limiter = peerLimiter(remote_id);
+
+    if (limiter)
+        limiter->setLimits(limits);
+    else
+        peerLimiters[remote_id] = new nixlXferLimiter(limits);
+    hasLimiters = true;
+}
+
+void nixlXferSched::setBackendLimits(const unsigned int &backend_id,
+                                     const nixl_xfer_limits_t &limits) {
+    if (backendLimiters[backend_id])
+        backendLimiters[backend_id]->setLimits(limits);
+    else
+        backendLimiters[backend_id] = new nixlXferLimiter(limits);
+    hasLimiters = true;
+}
+
+void nixlXferSched::charge(nixlXferReqH* handle) {
+    handle->charges.clear();
+    if (!hasLimiters)
+        return;
+
+    nixlXferLimiter* limiter = peerLimiter(handle->remoteId);
+    if (limiter)
+        handle->charges.push_back({limiter, handle->totalBytes});
+
+    if (!handle->hasParts()) {
+        limiter = backendLimiters[handle->engine->getId()];
+        if (limiter)
+            handle->charges.push_back({limiter, handle->totalBytes});
+        return;
+    }
+
+    for (auto & part : handle->parts()) {
+        limiter = backendLimiters[part->engine->getId()];
+        if (limiter)
+            handle->charges.push_back({limiter, part->totalBytes});
+    }
+}
+
+bool nixlXferSched::prioCanStart(const nixlXferReqH* handle) const {
+    return !highInflight &&
+           (!inflightBytes ||
+            (inflightBytes + handle->totalBytes <= maxInflightBytes));
+}
+
+bool nixlXferSched::mustReject(const nixlXferReqH* handle) const {
+    for (auto & elm : handle->charges)
+        if (elm.first->limits.reject &&
+            (elm.first->heldCount || !elm.first->canStart(elm.second)))
+            return true;
+    return false;
+}
+
+bool nixlXferSched::mustHold(const nixlXferReqH* handle) const {
+    if (maxInflightBytes && (handle->priority == NIXL_PRIO_LOW) &&
+        (lowHeld || !prioCanStart(handle)))
+        return true;
+
+    for (auto & elm : handle->charges)
+        if (elm.first->heldCount || !elm.first->canStart(elm.second))
+            return true;
+    return false;
+}
+
+bool nixlXferSched::canStartHeld(const nixlXferReqH* handle,
+                                 std::vector<nixlXferLimiter*> &blocked,
+                                 bool &low_blocked) const {
+    bool low   = maxInflightBytes && (handle->priority == NIXL_PRIO_LOW);
+    bool start = !low || (!low_blocked && prioCanStart(handle));
+
+    for (auto & elm : handle->charges) {
+        if (!start)
+            break;
+        start = (std::find(blocked.begin(), blocked.end(), elm.first) ==
+                 blocked.end()) && elm.first->canStart(elm.second);
+    }
+
+    if (start)
+        return true;
+
+    low_blocked |= low;
+    for (auto & elm : handle->charges)
+        blocked.push_back(elm.first);
+    return false;
+}
+
+bool nixlXferSched::wait(nixlXferReqH* handle,
+                         const std::vector<nixlXferReqH*> &deps) {
+    for (auto & dep : deps) {
+        if (dep->status != NIXL_IN_PROG)
+            continue;
+        handle->waitingOn.push_back(dep);
+        dep->dependents.push_back(handle);
+    }
+
+    if (handle->waitingOn.empty())
+        return false;
+
+    handle->held    = true;
+    handle->waiting = true;
+    handle->schedIt = waiting.insert(waiting.end(), handle);
+    return true;
+}
+
+void nixlXferSched::ready(nixlXferReqH* handle) {
+    waiting.erase(handle->schedIt);
+    handle->waiting = false;
+    hold(handle);
+}
+
+void nixlXferSched::hold(nixlXferReqH* handle) {
+    lowHeld += maxInflightBytes && (handle->priority == NIXL_PRIO_LOW);
+    for (auto & elm : handle->charges)
+        elm.first->heldCount++;
+    handle->held    = true;
+    handle->schedIt = held.insert(held.end(), handle);
+}
+
+void nixlXferSched::unhold(nixlXferReqH* handle) {
+    handle->depFailed = false;
+
+    if (handle->waiting) {
+        for (auto & dep : handle->waitingOn)
+            dep->dependents.erase(std::remove(dep->dependents.begin(),
+                                              dep->dependents.end(), handle),
+                                  dep->dependents.end());
+        handle->waitingOn.clear();
+        waiting.erase(handle->schedIt);
+        handle->waiting = false;
+        handle->held    = false;
+        return;
+    }
+
+    lowHeld -= maxInflightBytes && (handle->priority == NIXL_PRIO_LOW);
+    for (auto & elm : handle->charges)
+        elm.first->heldCount--;
+    held.erase(handle->schedIt);
+    handle->held = false;
+}
+
+void nixlXferSched::addInflight(nixlXferReqH* handle) {
+    inflightBytes    += handle->totalBytes;
+    highInflight     += (handle->priority == NIXL_PRIO_HIGH);
+    for (auto & elm : handle->charges)
+        elm.first->start(elm.second);
+    handle->inflight  = true;
+    handle->schedIt   = inflight.insert(inflight.end(), handle);
+}
+
+void nixlXferSched::remInflight(nixlXferReqH* handle) {
+    inflightBytes    -= handle->totalBytes;
+    highInflight     -= (handle->priority == NIXL_PRIO_HIGH);
+    for (auto & elm : handle->charges)
+        elm.first->done(elm.second);
+    handle->inflight  = false;
+    inflight.erase(handle->schedIt);
+}
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __TELEMETRY_H_
+#define __TELEMETRY_H_
+
+#include <array>
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include "nixl_types.h"
+#include "mem_section.h"
+
+// Counters of one peer or backend for one operation. The data path only does
+// relaxed increments, so getStats can take a snapshot from any thread without
+// synchronizing with it; a snapshot is not atomic across counters.
+class nixlXferCounters {
+    private:
+        std::atomic<uint64_t>                 postCount{0};
+        std::atomic<uint64_t>                 xferCount{0};
+        std::atomic<uint64_t>                 errorCount{0};
+        std::atomic<uint64_t>                 totalBytes{0};
+        std::atomic<uint64_t>                 descCount{0};
+        std::atomic<uint64_t>                 postedDescCount{0};
+        std::atomic<uint64_t>                 totalNs{0};
+        std::atomic<uint64_t>                 maxNs{0};
+        std::array<std::atomic<uint64_t>, 64> latencyBuckets{};
+
+    public:
+        inline void addPost () {
+            postCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void addXfer (const uint64_t &latency_ns, const uint64_t &bytes,
+                      const uint64_t &descs, const uint64_t &posted_descs);
+
+        inline void addError () {
+            errorCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void read (nixlXferStats &stats) const;
+};
+
+typedef std::array<nixlXferCounters, 2> nixl_op_counters_t;
+
+// Per peer and per backend transfer counters of an agent. Only the agent API
+// thread looks up and adds counters, and peer counters are allocated once per
+// agent id and never moved, so requests keep pointers to them.
+class nixlTelemetry {
+    private:
+        // Guards the growth of peers and backends against getStats
+        mutable std::mutex                                lock;
+        std::vector<std::unique_ptr<nixl_op_counters_t>>  peers;
+        std::vector<std::string>                          peerNames;
+
+        std::array<nixl_op_counters_t, NIXL_MAX_BACKENDS> backends;
+        std::vector<const nixlBackendEngine*>             engines;
+        std::array<std::atomic<uint64_t>,
+                   NIXL_MAX_BACKENDS>                     regBytes{};
+
+        std::atomic<uint64_t>                             notifsSent{0};
+        std::atomic<uint64_t>                             notifsReceived{0};
+
+    public:
+        nixlXferCounters* getPeer (const unsigned int &agent_id,
+                                   const std::string &agent_name,
+                                   const nixl_xfer_op_t &op);
+
+        inline nixlXferCounters* getBackend (const nixlBackendEngine* engine,
+                                             const nixl_xfer_op_t &op) {
+            return &backends[engine->getId()][op];
+        }
+
+        // Engines are added once created, and must outlive the telemetry
+        void addBackend (const nixlBackendEngine* engine);
+
+        // Registered bytes are added and removed per backend
+        inline void addRegBytes (const nixlBackendEngine* engine,
+                                 const uint64_t &bytes) {
+            regBytes[engine->getId()].fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        inline void remRegBytes (const nixlBackendEngine* engine,
+                                 const uint64_t &bytes) {
+            regBytes[engine->getId()].fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        inline void addNotifsSent (const uint64_t &count) {
+            notifsSent.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        inline void addNotifsReceived (const uint64_t &count) {
+            notifsReceived.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        void getStats (nixl_agent_stats_t &stats) const;
+
+        // Serializes a snapshot of the stats in Prometheus text or JSON
+        void exportStats (const std::string &agent_name,
+                          const nixl_stats_fmt_t &format,
+                          std::string &out) const;
+};
+
+// Background thread periodically writing the exported stats to a file. The
+// file is replaced through a rename, and written one last time when stopped.
+class nixlStatsExporter {
+    private:
+        const nixlTelemetry*    telemetry;
+        std::string             agentName;
+        std::string             path;
+        uint64_t                periodUs;
+        nixl_stats_fmt_t        format;
+
+        std::mutex              lock;
+        std::condition_variable cond;
+        bool                    stop = false;
+        std::thread             worker;
+
+        void run ();
+
+    public:
+        nixlStatsExporter (const nixlTelemetry* telemetry,
+                           const std::string &agent_name,
+                           const std::string &path,
+                           const uint64_t &period_us,
+                           const nixl_stats_fmt_t &format);
+        ~nixlStatsExporter ();
+
+        nixl_status_t write () const;
+};
+
+#endif
@@ -17,6 +17,60 @@
 #ifndef __TRANSFER_REQUEST_H_
 #define __TRANSFER_REQUEST_H_
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <list>
+#include <algorithm>
+#include "mem_section.h"
+#include "telemetry.h"
+#include "trace.h"
+#include "xfer_sched.h"
+#include "local_copy.h"
+#include "xfer_pack.h"
+
+class nixlXferBatch;
+class nixlXferStreamH;
+
+class nixlDlistH {
+    private:
+        std::unordered_map<nixlBackendEngine*, nixl_meta_dlist_t*> descs;
+        backend_mask_t     backends       = 0; // Keys of descs as a bitmask
+
+        std::string        remoteAgent;
+        unsigned int       remoteId       = 0;
+        bool               isLocal;
+
+        // Transfer requests viewing into descs without a copy keep the handle
+        // alive, so releasedDlistH only marks it and the last request deletes it.
+        mutable int        xferRefs       = 0;
+        mutable bool       released       = false;
+
+        static inline void unref(const nixlDlistH* dlist) {
+            if (dlist && (--dlist->xferRefs == 0) && dlist->released)
+                delete dlist;
+        }
+
+        static inline void release(nixlDlistH* dlist) {
+            if (dlist && (dlist->xferRefs > 0))
+                dlist->released = true;
+            else
+                delete dlist;
+        }
+
+    public:
+        inline nixlDlistH() { }
+
+        inline ~nixlDlistH() {
+            for (auto & elm : descs)
+                delete elm.second;
+        }
+
+    friend class nixlAgent;
+    friend class nixlXferReqH;
+    friend class nixlXferCache;
+};
+
 // Contains pointers to corresponding backend engine and its handler, and populated
 // and verified DescLists, and other state and metadata needed for a NIXL transfer
 class nixlXferReqH {
@@ -24,16 +78,160 @@ class nixlXferReqH {
         nixlBackendEngine* engine         = nullptr;
         nixlBackendReqH*   backendHandle  = nullptr;
 
+        // Descriptor lists owned by the request, when they had to be built
         nixl_meta_dlist_t* initiatorDescs = nullptr;
         nixl_meta_dlist_t* targetDescs    = nullptr;
 
+        // What is passed to the backend, viewing either into the owned lists
+        // above, or directly into the prepared dlist handles (no copy case)
+        nixl_meta_dview_t  initiatorView;
+        nixl_meta_dview_t  targetView;
+        std::vector<int>   initiatorIdx;
+        std::vector<int>   targetIdx;
+        const nixlDlistH*  localSide      = nullptr;
+        const nixlDlistH*  remoteSide     = nullptr;
+
         std::string        remoteAgent;
+        unsigned int       remoteId       = 0; // Interned remoteAgent
         nixl_blob_t        notifMsg;
         bool               hasNotif       = false;
 
         nixl_xfer_op_t     backendOp;
         nixl_status_t      status;
 
+        // Deadline of the current post, from the timeout given in microseconds
+        nixlTime::us_t     timeout        = 0;
+        nixlTime::us_t     deadline       = 0;
+        // The backend handle was given up by cancelXferReq or a timeout
+        bool               canceled       = false;
+
+        // Telemetry of the request, counters are nullptr when it is disabled
+        nixlXferCounters*  peerStats      = nullptr;
+        nixlXferCounters*  backendStats   = nullptr;
+        uint64_t           totalBytes     = 0;
+        uint64_t           userDescCount  = 0;
+        nixlTime::ns_t     postTime       = 0;
+        // The current post is traced as a span till its completion
+        bool               traced         = false;
+
+        // Scheduling of the post, either held back or in progress, and the
+        // peer and backend limiters it is charged to
+        nixl_xfer_prio_t   priority       = NIXL_PRIO_NORMAL;
+        nixlXferSched*     sched          = nullptr;
+        bool               held           = false;
+        bool               inflight       = false;
+        xfer_charges_t     charges;
+        // A completed backend handle to release when the held post starts
+        bool               heldRelease    = false;
+        std::list<nixlXferReqH*>::iterator schedIt;
+
+        // Chained posts, a waiting post depends on the transfers in waitingOn,
+        // and the posts in dependents are released when this one ends. They
+        // fail without being started if a transfer they depend on did not
+        // complete successfully.
+        bool               waiting        = false;
+        bool               depFailed      = false;
+        std::vector<nixlXferReqH*> waitingOn;
+        std::vector<nixlXferReqH*> dependents;
+
+        // Parts of a request made of several, each with its own engine,
+        // descriptors and backend handle. Only one of the lists below is used,
+        // and parts() returns it. The handle has no backend handle itself.
+        //
+        // Stripes of a transfer split across several backends by the agent.
+        // They don't notify, the engine of the handle does once all of them
+        // completed, and the handle only has the peer counters while the
+        // stripes have the backend ones.
+        std::vector<nixlXferReqH*> stripes;
+        // Segments given by the user, viewing into the descriptors of the
+        // handle, each with its own optional notification. They are also the
+        // chunks of the stream over the request, if any.
+        std::vector<nixlXferReqH*> segments;
+        nixlXferStreamH*   stream         = nullptr;
+        // Full requests to each peer of a broadcast or gather, with their own
+        // peer counters, each carrying the notification of the handle
+        std::vector<nixlXferReqH*> peerParts;
+
+        // Coalesced post, the batch has the backend handle and the status
+        nixlXferBatch*     batch          = nullptr;
+        // Loopback DRAM transfer copied by the agent, the backend handle
+        // is only prepared
+        nixlCopyJob*       copyJob        = nullptr;
+        // Write of small descriptors sent through staging buffers
+        nixlXferPack*      pack           = nullptr;
+
+        inline std::vector<nixlXferReqH*>& parts() {
+            if (!segments.empty())
+                return segments;
+            if (!peerParts.empty())
+                return peerParts;
+            return stripes;
+        }
+
+        inline const std::vector<nixlXferReqH*>& parts() const {
+            return const_cast<nixlXferReqH*>(this)->parts();
+        }
+
+        inline bool hasParts() const {
+            return !parts().empty();
+        }
+
+        inline int postedDescCount() const {
+            int count = initiatorView.descCount();
+            for (auto & part : parts())
+                count += part->initiatorView.descCount();
+            return count;
+        }
+
+        inline void releaseDependents(const bool &failed) {
+            for (auto & dep : dependents) {
+                auto &deps = dep->waitingOn;
+                deps.erase(std::remove(deps.begin(), deps.end(), this), deps.end());
+                dep->depFailed |= failed;
+                // Could be listed twice if it depended on this post twice
+                if (deps.empty() && dep->waiting)
+                    dep->sched->ready(dep);
+            }
+            dependents.clear();
+        }
+
+        // Records the status that ended the current post, if any
+        inline void recordDone(const nixl_status_t &new_status) {
+            if (new_status == NIXL_IN_PROG)
+                return;
+
+            if (inflight)
+                sched->remInflight(this);
+
+            if (!dependents.empty())
+                releaseDependents(new_status != NIXL_SUCCESS);
+
+            if (traced) {
+                nixlTrace::record((new_status == NIXL_SUCCESS) ? "xfer" : "xferFailed",
+                                  "nixl", postTime, nixlTime::getNs(),
+                                  postedDescCount());
+                traced = false;
+            }
+
+            if (!peerStats && !backendStats)
+                return;
+
+            if (new_status == NIXL_SUCCESS) {
+                uint64_t latency = nixlTime::getNs() - postTime;
+                uint64_t posted  = postedDescCount();
+
+                if (peerStats)
+                    peerStats->addXfer(latency, totalBytes, userDescCount, posted);
+                if (backendStats)
+                    backendStats->addXfer(latency, totalBytes, userDescCount, posted);
+            } else {
+                if (peerStats)
+                    peerStats->addError();
+                if (backendStats)
+                    backendStats->addError();
+            }
+        }
+
     public:
         inline nixlXferReqH() { }
 
@@ -43,27 +241,164 @@ class nixlXferReqH {
             delete targetDescs;
             if (backendHandle != nullptr)
                 engine->releaseReqH(backendHandle);
+            nixlDlistH::unref(localSide);
+            nixlDlistH::unref(remoteSide);
+            for (auto & part : parts())
+                delete part;
+            if (held)
+                sched->unhold(this);
+            if (inflight)
+                sched->remInflight(this);
+            if (!dependents.empty())
+                releaseDependents(true);
+            if (batch)
+                leaveBatch();
+            delete copyJob;
+            delete pack;
         }
 
+        inline void leaveBatch();
+
     friend class nixlAgent;
+    friend class nixlAgentData;
+    friend class nixlXferSched;
+    friend class nixlXferStreamH;
+    friend class nixlXferBatch;
 };
 
-class nixlDlistH {
+// Small posts to the same peer over the same backend, coalesced into one
+// backend transfer. The batch is open while it gathers posts, then it is
+// posted with the descriptors of all its members, which read its status
+// till they are posted again or released. An open batch left without
+// members is deleted by the agent, a posted one by its last member.
+class nixlXferBatch {
     private:
-        std::unordered_map<nixlBackendEngine*, nixl_meta_dlist_t*> descs;
+        nixlBackendEngine*         engine;
+        std::string                remoteAgent;
+        unsigned int               remoteId;
+        nixl_xfer_op_t             backendOp;
+        nixl_xfer_prio_t           priority;
+        nixlTime::us_t             openTime;
+        bool                       open          = true;
 
-        std::string        remoteAgent;
-        bool               isLocal;
+        nixl_meta_dlist_t          initiatorDescs;
+        nixl_meta_dlist_t          targetDescs;
+        nixlBackendReqH*           backendHandle = nullptr;
+        nixl_status_t              status        = NIXL_IN_PROG;
+
+        std::vector<nixlXferReqH*> members;
 
     public:
-        inline nixlDlistH() { }
+        inline nixlXferBatch(const nixlXferReqH* first) :
+            engine(first->engine), remoteAgent(first->remoteAgent),
+            remoteId(first->remoteId), backendOp(first->backendOp),
+            priority(first->priority), openTime(nixlTime::getUs()),
+            initiatorDescs(first->initiatorView.getType()),
+            targetDescs(first->targetView.getType()) { }
 
-        inline ~nixlDlistH() {
-            for (auto & elm : descs)
-                delete elm.second;
+        inline bool matches(const nixlXferReqH* handle) const {
+            return (engine == handle->engine) && (remoteId == handle->remoteId) &&
+                   (backendOp == handle->backendOp) && (priority == handle->priority);
+        }
+
+        inline ~nixlXferBatch() {
+            // Aborted, or released after completion
+            if (backendHandle != nullptr)
+                engine->releaseReqH(backendHandle);
+        }
+
+    friend class nixlAgent;
+    friend class nixlAgentData;
+    friend class nixlXferReqH;
+};
+
+inline void nixlXferReqH::leaveBatch() {
+    auto &members = batch->members;
+    members.erase(std::find(members.begin(), members.end(), this));
+
+    if (members.empty() && !batch->open)
+        delete batch;
+    batch = nullptr;
+}
+
+// Stream of chunks over a segmented transfer request, each chunk being the
+// next segment. Chunks complete in order as seen by the agent: notified is
+// the number of chunks completed and notified, posted the number of chunks
+// posted in the current round. A chunk notification is given to the backend
+// post only if all the previous chunks were notified, otherwise it is kept
+// in pendingNotifs and sent by the agent once its turn comes.
+class nixlXferStreamH {
+    private:
+        nixlXferReqH*            req;
+        size_t                   posted   = 0;
+        size_t                   notified = 0;
+        std::vector<nixl_blob_t> pendingNotifs;
+        // A failed chunk ends the stream, it can only be released
+        nixl_status_t            failure  = NIXL_SUCCESS;
+
+    public:
+        inline nixlXferStreamH(nixlXferReqH* req) :
+            req(req), pendingNotifs(req->segments.size()) {
+            req->stream = this;
+        }
+
+        inline ~nixlXferStreamH() {
+            req->stream = nullptr;
+        }
+
+    friend class nixlAgent;
+};
+
+// Background registration of registerMemAsync. Its tasks on the agent pool
+// pre-fault DRAM, then register with the backends that support parallel
+// registration, and the results are added to the local section by the agent
+// in getRegStatus, which registers with the other backends, so agent data is
+// only touched from the user thread.
+class nixlRegReqH {
+    private:
+        nixl_reg_dlist_t                          descs;
+        std::vector<nixlBackendEngine*>           backends;
+
+        // If the worker registers the descriptors, or the local section does
+        // when they are added (registration cache or coalescing)
+        bool                                      preRegistered;
+        // Per backend, metadata and status of each descriptor
+        std::vector<std::vector<nixlBackendMD*>>  metadata;
+        std::vector<std::vector<nixl_status_t>>   rets;
+
+        // Pre-fault chunks (address and length), then parallel registrations
+        // (backend index and descriptor index), each one a task
+        std::vector<std::pair<uintptr_t, size_t>> chunks;
+        std::vector<std::pair<size_t, int>>       regTasks;
+        // Tasks of the current phase still running
+        std::atomic<size_t>                       pending{0};
+
+        std::mutex                                doneLock;
+        std::condition_variable                   doneCv;
+        std::atomic<bool>                         done{false};
+        bool                                      committed = false;
+        nixl_status_t                             status    = NIXL_IN_PROG;
+
+    public:
+        inline nixlRegReqH(const nixl_reg_dlist_t &descs) : descs(descs) { }
+
+        // Called by the last task
+        inline void finish() {
+            {
+                std::lock_guard<std::mutex> lk(doneLock);
+                done.store(true, std::memory_order_release);
+            }
+            doneCv.notify_all();
+        }
+
+        // Before deleting it, as the tasks still use it
+        inline void wait() {
+            std::unique_lock<std::mutex> lk(doneLock);
+            doneCv.wait(lk, [this] { return done.load(std::memory_order_acquire); });
         }
 
     friend class nixlAgent;
+    friend class nixlAgentData;
 };
 
 #endif
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __XFER_CACHE_H_
+#define __XFER_CACHE_H_
+
+#include <list>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include "nixl.h"
+
+class nixlDlistH;
+class nixlBackendEngine;
+
+// Memoizes the prepared dlist handles of both sides of createXferReq, keyed by
+// the descriptor lists, the remote agent and the backend hints. Entries are
+// kept in LRU order, and must be invalidated when the populate results could
+// change, i.e., when local or remote metadata is updated.
+class nixlXferCache {
+    private:
+        class nixlXferCacheEntry {
+            public:
+                uint64_t                        hash;
+                std::string                     remoteAgent;
+                nixl_xfer_dlist_t               localDescs;
+                nixl_xfer_dlist_t               remoteDescs;
+                std::vector<nixlBackendEngine*> backends;
+
+                nixlDlistH*                     localSide;
+                nixlDlistH*                     remoteSide;
+                // Identity selection over the prepared lists
+                std::vector<int>                indices;
+
+                nixlXferCacheEntry(const nixl_xfer_dlist_t &local_descs,
+                                   const nixl_xfer_dlist_t &remote_descs)
+                    : localDescs(local_descs), remoteDescs(remote_descs) {}
+        };
+
+        typedef std::list<nixlXferCacheEntry> entry_list_t;
+
+        size_t                                           capacity;
+        entry_list_t                                     entries;
+        std::unordered_map<uint64_t,
+                           entry_list_t::iterator>       entryMap;
+
+        void evict (entry_list_t::iterator it);
+
+    public:
+        nixlXferCache (const size_t &capacity);
+        ~nixlXferCache ();
+
+        static uint64_t getHash (const nixl_xfer_dlist_t &local_descs,
+                                 const nixl_xfer_dlist_t &remote_descs,
+                                 const std::string &remote_agent,
+                                 const nixl_opt_args_t* extra_params);
+
+        // On a hit, outputs the cached handles and the indices to use for them
+        bool lookup (const uint64_t &hash,
+                     const nixl_xfer_dlist_t &local_descs,
+                     const nixl_xfer_dlist_t &remote_descs,
+                     const std::string &remote_agent,
+                     const nixl_opt_args_t* extra_params,
+                     nixlDlistH* &local_side,
+                     nixlDlistH* &remote_side,
+                     const std::vector<int>* &indices);
+
+        // Takes ownership of the handles, and returns the indices to use for them
+        const std::vector<int>* insert (const uint64_t &hash,
+                                        const nixl_xfer_dlist_t &local_descs,
+                                        const nixl_xfer_dlist_t &remote_descs,
+                                        const std::string &remote_agent,
+                                        const nixl_opt_args_t* extra_params,
+                                        nixlDlistH* local_side,
+                                        nixlDlistH* remote_side);
+
+        void invalidate ();
+        void invalidate (const std::string &remote_agent);
+};
+
+#endif
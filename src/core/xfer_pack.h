@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __XFER_PACK_H_
+#define __XFER_PACK_H_
+
+#include <string>
+#include <unordered_map>
+#include "nixl_types.h"
+#include "backend/backend_aux.h"
+
+class nixlXferPack;
+// Packed posts waiting for their ack, by sequence number
+typedef std::unordered_map<uint64_t, nixlXferPack*> nixl_pack_waits_t;
+
+// Staged write of many small DRAM descriptors. At each post the source
+// descriptors are gathered into the local staging buffer, which is written
+// to the remote staging buffer as one backend transfer. Its notification
+// starts with the layout of the destination descriptors, for the remote
+// agent to scatter the staging buffer into them when it receives it, and
+// then carries the notification message of the user if there is one.
+//
+// Each agent packing transfers advertises a random key in its metadata,
+// and packed messages are only recognized with the key of their receiver,
+// so user messages are not mistaken for them. Once scattered, the target
+// acknowledges the post, and the initiator only completes it then, as the
+// staging buffers are in use till that point.
+class nixlXferPack {
+    public:
+        static const size_t keyLen = 16;
+
+    private:
+        nixl_meta_dlist_t  localStaging;
+        nixl_meta_dlist_t  remoteStaging;
+        // Encoded header and destination descriptors, built once
+        nixl_blob_t        layout;
+
+        // Current post, waiting in waits till its ack is received, and the
+        // scatter status of the target then
+        nixl_pack_waits_t &waits;
+        uint64_t           seq       = 0;
+        bool               waiting   = false;
+        bool               sent      = false;
+        nixl_status_t      ackStatus = NIXL_IN_PROG;
+
+    public:
+        nixlXferPack(const nixl_meta_dview_t &target,
+                     const uintptr_t &remote_staging,
+                     const std::string &remote_key,
+                     const std::string &local_key,
+                     nixl_pack_waits_t &waits);
+        ~nixlXferPack();
+
+        // Copies the source descriptors back to back into the local staging
+        void gather(const nixl_meta_dview_t &initiator) const;
+        // Starts waiting for the ack of a new post, returning its
+        // notification message, with the user one if any
+        nixl_blob_t post(const uint64_t &new_seq, const bool &has_notif,
+                         const nixl_blob_t &msg);
+        // Stops waiting for the ack of the current post
+        void drop();
+
+        // Random key of an agent, for its metadata
+        static std::string makeKey();
+        static bool isPacked(const nixl_blob_t &msg, const std::string &key);
+        static bool isAck(const nixl_blob_t &msg, const std::string &key);
+        // Reads the layout of a received packed transfer, leaving the user
+        // message in msg. NIXL_ERR_INVALID_PARAM if it is malformed.
+        static nixl_status_t parse(nixl_blob_t &msg, nixlBasicDesc &staging,
+                                   nixl_xfer_dlist_t &descs, bool &has_notif,
+                                   std::string &ack_key, uint64_t &ack_seq);
+        // Copies the staging back into the destination descriptors
+        static void scatter(const nixlBasicDesc &staging,
+                            const nixl_xfer_dlist_t &descs);
+        // Ack of a scatter, and its processing by the initiator, which
+        // ignores the acks of posts not waiting anymore
+        static nixl_blob_t ackMsg(const std::string &key, const uint64_t &ack_seq,
+                                  const nixl_status_t &status);
+        static void ack(const nixl_blob_t &msg, nixl_pack_waits_t &waits);
+
+    friend class nixlAgent;
+    friend class nixlAgentData;
+};
+
+#endif
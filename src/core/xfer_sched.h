@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __XFER_SCHED_H_
+#define __XFER_SCHED_H_
+
+#include <list>
+#include <array>
+#include <vector>
+#include "nixl_types.h"
+#include "mem_section.h"
+#include "common/nixl_time.h"
+
+class nixlXferReqH;
+
+static inline bool hasXferLimits(const nixl_xfer_limits_t &limits) {
+    return limits.rateBytesPerSec || limits.maxInflightBytes ||
+           limits.maxInflightReqs;
+}
+
+// Token bucket and in-flight caps of the transfers to one peer or through one
+// backend. Tokens are bytes, and a post only needs the tokens of up to a burst
+// to start, so larger transfers run the bucket into debt instead of never
+// starting.
+class nixlXferLimiter {
+    private:
+        nixl_xfer_limits_t limits;
+        double             tokens        = 0;
+        nixlTime::us_t     lastRefill    = 0;
+        uint64_t           inflightBytes = 0;
+        uint64_t           inflightReqs  = 0;
+        // Held posts charged to it, later posts have to wait behind them
+        unsigned int       heldCount     = 0;
+
+        inline uint64_t burst() const {
+            return limits.burstBytes ? limits.burstBytes : limits.rateBytesPerSec;
+        }
+
+    public:
+        nixlXferLimiter(const nixl_xfer_limits_t &limits);
+
+        // Keeps the transfers in progress, and the tokens up to the new burst
+        void setLimits(const nixl_xfer_limits_t &new_limits);
+        bool canStart(const uint64_t &bytes);
+        void start(const uint64_t &bytes);
+        void done(const uint64_t &bytes);
+
+    friend class nixlXferSched;
+};
+
+typedef std::vector<std::pair<nixlXferLimiter*, uint64_t>> xfer_charges_t;
+
+// Scheduling of the agent transfers, tracking the ones in progress and the
+// posts held back, either low priority ones or ones over the limits of their
+// peer or backends. Held posts are started in order within each of these.
+// Chained posts wait apart till the transfers they depend on have ended, and
+// are then held as any other post.
+class nixlXferSched {
+    private:
+        // Priority scheduling, disabled when maxInflightBytes is 0
+        uint64_t                  maxInflightBytes;
+        uint64_t                  inflightBytes = 0;
+        unsigned int              highInflight  = 0;
+        unsigned int              lowHeld       = 0;
+        std::list<nixlXferReqH*>  inflight;
+        std::list<nixlXferReqH*>  held;
+        std::list<nixlXferReqH*>  waiting;
+
+        // Limiters by remote agent id and backend id, nullptr for no limits.
+        // Peers without their own get one with the defaults when needed.
+        nixl_xfer_limits_t                                 peerDefault;
+        bool                                               hasPeerDefault;
+        std::vector<nixlXferLimiter*>                      peerLimiters;
+        std::array<nixlXferLimiter*, NIXL_MAX_BACKENDS>    backendLimiters{};
+        bool                                               hasLimiters;
+
+        bool prioCanStart(const nixlXferReqH* handle) const;
+        nixlXferLimiter* peerLimiter(const unsigned int &remote_id);
+
+    public:
+        nixlXferSched(const uint64_t &max_inflight_bytes,
+                      const nixl_xfer_limits_t &peer_default);
+        ~nixlXferSched();
+
+        void setPeerLimits(const unsigned int &remote_id,
+                           const nixl_xfer_limits_t &limits);
+        void setBackendLimits(const unsigned int &backend_id,
+                              const nixl_xfer_limits_t &limits);
+
+        inline bool hasHeld() const { return !held.empty() || !waiting.empty(); }
+
+        // Sets the limiters a new post of the handle goes through
+        void charge(nixlXferReqH* handle);
+        // If a limiter of the post rejects it rather than holding it
+        bool mustReject(const nixlXferReqH* handle) const;
+        // If the post has to wait, held posts of its groups are ahead of it
+        bool mustHold(const nixlXferReqH* handle) const;
+        // If a held post can start, otherwise it blocks the later held posts
+        // of its groups, collected in blocked and low_blocked during a scan
+        bool canStartHeld(const nixlXferReqH* handle,
+                          std::vector<nixlXferLimiter*> &blocked,
+                          bool &low_blocked) const;
+
+        // Makes the post wait for the deps still in progress, if any
+        bool wait(nixlXferReqH* handle, const std::vector<nixlXferReqH*> &deps);
+        // Holds a waiting post once all its deps have ended
+        void ready(nixlXferReqH* handle);
+        void hold(nixlXferReqH* handle);
+        // Drops a held or waiting post
+        void unhold(nixlXferReqH* handle);
+        void addInflight(nixlXferReqH* handle);
+        void remInflight(nixlXferReqH* handle);
+
+    friend class nixlAgentData;
+};
+
+#endif
@@ -26,26 +26,67 @@
 #include "nixl_descriptors.h"
 #include "nixl.h"
 #include "backend/backend_engine.h"
+#include "common/thread_pool.h"
+#include "reg_cache.h"
 
-typedef std::pair<nixl_mem_t, nixlBackendEngine*>              section_key_t;
-typedef std::set<nixlBackendEngine*>                           backend_set_t;
+// Engines get a small id within their agent in creation order, so a set of
+// backends is a bitmask and sections are kept in a flat [mem][id] table.
+#define NIXL_MAX_BACKENDS 64
+
+typedef uint64_t                                               backend_mask_t;
 typedef std::unordered_map<nixl_backend_t, nixlBackendEngine*> backend_map_t;
 
+static inline backend_mask_t backendBit (const nixlBackendEngine* backend) {
+    return ((backend_mask_t) 1) << backend->getId();
+}
+
+// Returns the lowest backend id in the mask and removes it, to iterate a mask
+// in creation (preference) order
+static inline unsigned int popBackend (backend_mask_t &mask) {
+    unsigned int id = __builtin_ctzll(mask);
+    mask &= mask - 1;
+    return id;
+}
 
 class nixlMemSection {
     protected:
-        std::array<backend_set_t, FILE_SEG+1>         memToBackend;
-        std::map<section_key_t,   nixl_meta_dlist_t*> sectionMap;
+        typedef std::array<nixl_meta_dlist_t*, NIXL_MAX_BACKENDS> section_row_t;
+
+        std::array<backend_mask_t, FILE_SEG+1>        memToBackend;
+        std::array<section_row_t,  FILE_SEG+1>        sectionMap;
+        std::array<nixlBackendEngine*, NIXL_MAX_BACKENDS> engines;
+
+        // Returns nullptr if there is no section for the mem type and backend
+        inline nixl_meta_dlist_t* getSection (const nixl_mem_t &mem,
+                                              const nixlBackendEngine* backend) const {
+            if ((mem < DRAM_SEG) || (mem > FILE_SEG))
+                return nullptr;
+            return sectionMap[mem][backend->getId()];
+        }
+
+        // Returns the section, creating it if it doesn't exist
+        nixl_meta_dlist_t* addSection (const nixl_mem_t &mem,
+                                       nixlBackendEngine* backend);
+        void remSection (const nixl_mem_t &mem, nixlBackendEngine* backend);
 
     public:
-        nixlMemSection () {};
+        nixlMemSection () : memToBackend{}, sectionMap{}, engines{} {};
 
-        backend_set_t* queryBackends (const nixl_mem_t &mem);
+        backend_mask_t queryBackends (const nixl_mem_t &mem) const;
 
         nixl_status_t populate (const nixl_xfer_dlist_t &query,
                                 nixlBackendEngine* backend,
                                 nixl_meta_dlist_t &resp) const;
 
+        // Populate the query for several backends, per backend status is set
+        // in rets. With a pool, large queries are split into chunks and the
+        // chunks of all the backends are populated concurrently. Each resp
+        // should be created with the type, sortedness and size of the query.
+        void populate (const nixl_xfer_dlist_t &query,
+                       const std::vector<nixlBackendEngine*> &backends,
+                       std::vector<nixl_meta_dlist_t*> &resps,
+                       std::vector<nixl_status_t> &rets,
+                       nixlThreadPool* pool) const;
 
         virtual ~nixlMemSection () = 0; // Making the class abstract
 };
@@ -53,13 +94,60 @@ class nixlMemSection {
 
 class nixlLocalSection : public nixlMemSection {
     private:
+        // In coalesced mode a section entry is the union of overlapping or
+        // adjacent user registrations, kept until all of them are removed.
+        // Regions merged into a bigger one stay registered in retired, as
+        // already prepared handles might still point to their metadata.
+        class nixlMergedRegion {
+            public:
+                std::map<nixlBasicDesc, int> users;
+                std::vector<nixlBackendMD*>  retired;
+        };
+        typedef std::map<nixlBasicDesc, nixlMergedRegion> merged_map_t;
+
+        // Optional registration cache, can be nullptr
+        nixlRegCache* regCache = nullptr;
+
+        bool coalesce;
+        std::unordered_map<const nixl_meta_dlist_t*, merged_map_t> mergedRegions;
+
         nixl_reg_dlist_t getStringDesc (
                                const nixlBackendEngine* backend,
                                const nixl_meta_dlist_t &d_list) const;
+
+        nixl_status_t registerDesc (const nixlBlobDesc &desc,
+                                    const nixl_mem_t &nixl_mem,
+                                    nixlBackendEngine* backend,
+                                    nixlBackendMD* &metadata);
+        void deregisterDesc (nixlBackendMD* metadata,
+                             nixlBackendEngine* backend);
+
+        nixl_status_t addCoalesced (const nixlBlobDesc &desc,
+                                    const nixl_mem_t &nixl_mem,
+                                    nixlBackendEngine* backend,
+                                    nixl_meta_dlist_t &target,
+                                    nixl_meta_dlist_t &remote_self);
+        nixl_status_t remCoalesced (const nixlBasicDesc &desc,
+                                    nixlBackendEngine* backend,
+                                    nixl_meta_dlist_t &target);
     public:
+        // A non zero reg_cache_size enables the registration cache, with that
+        // many bytes of idle registrations kept alive. With coalesce, DRAM and
+        // VRAM registrations are merged into disjoint backend registrations.
+        nixlLocalSection (const size_t &reg_cache_size = 0,
+                          const bool &coalesce = false);
+
+        // With registered, the descriptors were already registered in the
+        // backend by the caller, registered[i] being the metadata of mem_elms[i].
+        // On errors they are deregistered, same as the ones registered here.
         nixl_status_t addDescList (const nixl_reg_dlist_t &mem_elms,
                                    nixlBackendEngine* backend,
-                                   nixl_meta_dlist_t &remote_self);
+                                   nixl_meta_dlist_t &remote_self,
+                                   const std::vector<nixlBackendMD*>* registered = nullptr);
+
+        // If the section registers mem in the backend as given, without the
+        // registration cache or coalescing, so it can be done by the caller
+        bool registersDirectly (const nixl_mem_t &mem) const;
 
         // Each nixlBasicDesc should be same as original registration region
         nixl_status_t remDescList (const nixl_meta_dlist_t &mem_elms,
@@ -67,6 +155,9 @@ class nixlLocalSection : public nixlMemSection {
 
         nixl_status_t serialize(nixlSerDes* serializer) const;
 
+        // Memory in descs is being freed, drops its idle cached registrations
+        nixl_status_t releasedMem (const nixl_xfer_dlist_t &descs);
+
         ~nixlLocalSection();
 };
 
@@ -75,6 +166,9 @@ class nixlRemoteSection : public nixlMemSection {
     private:
         std::string agentName;
 
+        // Local entries replaced by a covering one, unloaded at destruction
+        std::vector<std::pair<nixlBackendEngine*, nixlBackendMD*>> retired;
+
         nixl_status_t addDescList (
                            const nixl_reg_dlist_t &mem_elms,
                            nixlBackendEngine *backend);
@@ -84,7 +178,8 @@ class nixlRemoteSection : public nixlMemSection {
         nixl_status_t loadRemoteData (nixlSerDes* deserializer,
                                       backend_map_t &backendToEngineMap);
 
-        // When adding self as a remote agent for local operations
+        // When adding self as a remote agent for local operations. Entries
+        // covered by a new one are replaced, to keep merged regions disjoint.
         nixl_status_t loadLocalData (const nixl_meta_dlist_t& mem_elms,
                                      nixlBackendEngine* backend);
         ~nixlRemoteSection();
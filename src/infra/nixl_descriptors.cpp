@@ -170,43 +170,47 @@ nixlDescList<T>::nixlDescList(nixlSerDes* deserializer) {
         return;
 
     // nixlMetaDesc should be internal and not be serialized
-    if ((str == "nixlMDList") || (std::is_same<nixlMetaDesc, T>::value))
-        return;
-
-    if (deserializer->getBuf("t", &type, sizeof(type)))
-        return;
-    if (deserializer->getBuf("s", &sorted, sizeof(sorted)))
-        return;
-    if (deserializer->getBuf("n", &n_desc, sizeof(n_desc)))
+    if constexpr (std::is_same<nixlMetaDesc, T>::value) {
         return;
+    } else {
+        if (str == "nixlMDList")
+            return;
 
-    if (std::is_same<nixlBasicDesc, T>::value) {
-        // Contiguous in memory, so no need for per elm deserialization
-        if (str!="nixlBDList")
+        if (deserializer->getBuf("t", &type, sizeof(type)))
             return;
-        str = deserializer->getStr("");
-        if (str.size()!= n_desc * sizeof(nixlBasicDesc))
+        if (deserializer->getBuf("s", &sorted, sizeof(sorted)))
             return;
-        // If size is proper, deserializer cannot fail
-        descs.resize(n_desc);
-        str.copy(reinterpret_cast<char*>(descs.data()), str.size());
-
-    } else if (std::is_same<nixlBlobDesc, T>::value) {
-        if (str!="nixlSDList")
+        if (deserializer->getBuf("n", &n_desc, sizeof(n_desc)))
             return;
-        for (size_t i=0; i<n_desc; ++i) {
+
+        if constexpr (std::is_same<nixlBasicDesc, T>::value) {
+            // Contiguous in memory, so no need for per elm deserialization
+            if (str!="nixlBDList")
+                return;
             str = deserializer->getStr("");
+            if (str.size()!= n_desc * sizeof(nixlBasicDesc))
+                return;
             // If size is proper, deserializer cannot fail
-            // Allowing empty strings, might change later
-            if (str.size() < sizeof(nixlBasicDesc)) {
-                descs.clear();
+            descs.resize(n_desc);
+            str.copy(reinterpret_cast<char*>(descs.data()), str.size());
+
+        } else if constexpr (std::is_same<nixlBlobDesc, T>::value) {
+            if (str!="nixlSDList")
                 return;
+            descs.reserve(n_desc);
+            for (size_t i=0; i<n_desc; ++i) {
+                str = deserializer->getStr("");
+                // If size is proper, deserializer cannot fail
+                // Allowing empty strings, might change later
+                if (str.size() < sizeof(nixlBasicDesc)) {
+                    descs.clear();
+                    return;
+                }
+                descs.emplace_back(str);
             }
-            T elm(str);
-            descs.push_back(elm);
+        } else {
+            return; // Unknown type, error
         }
-    } else {
-        return; // Unknown type, error
     }
 }
 
@@ -319,107 +323,132 @@ bool nixlDescList<T>::verifySorted() {
     return true;
 }
 
+// Populate kernels for [start, end) of the query, one per sortedness of the
+// section and the query, so the choice is made once per call and not per
+// descriptor. They return false if a descriptor is not covered.
+template <class T, bool s_sorted, bool q_sorted>
+static bool populateKernel (const std::vector<T> &descs,
+                            typename std::vector<nixlBasicDesc>::const_iterator query,
+                            typename std::vector<T>::iterator resp,
+                            const int &start, const int &end) {
+
+    typename std::vector<T>::const_iterator itr;
+    bool found;
+
+    if constexpr (!s_sorted) {
+        for (int i=start; i<end; ++i) {
+            found = false;
+            for (itr = descs.begin(); itr != descs.end(); ++itr)
+                if ((*itr).covers(query[i])) {
+                    found = true;
+                    break;
+                }
+            if (!found)
+                return false;
+            static_cast<nixlBasicDesc&>(resp[i]) = query[i];
+            resp[i].copyMeta(*itr);
+        }
+    } else if constexpr (q_sorted) {
+        itr = descs.begin();
+
+        // A chunk in the middle of the query starts from the entry that
+        // could cover its first descriptor, as in the unsorted query case
+        if ((start > 0) && (start < end)) {
+            itr = std::lower_bound(descs.begin(), descs.end(), query[start]);
+            if (itr != descs.begin())
+                itr--;
+        }
+
+        for (int i=start; i<end; ++i) {
+            while ((itr != descs.end()) && !(*itr).covers(query[i]))
+                itr++;
+            if (itr == descs.end())
+                return false;
+            static_cast<nixlBasicDesc&>(resp[i]) = query[i];
+            resp[i].copyMeta(*itr);
+        }
+    } else {
+        for (int i=start; i<end; ++i) {
+            found = false;
+            itr = std::lower_bound(descs.begin(), descs.end(), query[i]);
+
+            // Same start address case
+            if ((itr != descs.end()) && (*itr).covers(query[i]))
+                found = true;
+
+            // query starts starts later, try previous entry
+            if ((!found) && (itr != descs.begin())) {
+                itr--;
+                if ((*itr).covers(query[i]))
+                    found = true;
+            }
+
+            if (!found)
+                return false;
+            static_cast<nixlBasicDesc&>(resp[i]) = query[i];
+            resp[i].copyMeta(*itr);
+        }
+    }
+    return true;
+}
+
 template <class T>
 nixl_status_t nixlDescList<T>::populate (const nixlDescList<nixlBasicDesc> &query,
                                          nixlDescList<T> &resp) const {
     // Populate only makes sense when there is extra metadata
-    if (std::is_same<nixlBasicDesc, T>::value)
+    if constexpr (std::is_same<nixlBasicDesc, T>::value) {
         return NIXL_ERR_INVALID_PARAM;
+    } else {
+        if ((type != query.getType()) || (type != resp.type))
+            return NIXL_ERR_INVALID_PARAM;
 
-    if ((type != query.getType()) || (type != resp.type))
-        return NIXL_ERR_INVALID_PARAM;
-
-    // 1-to-1 mapping cannot hold
-    if (query.isSorted() != resp.sorted)
-        return NIXL_ERR_INVALID_PARAM;
-
-    T new_elm;
-    nixlBasicDesc *p = &new_elm;
-    int count = 0, last_found = 0;
-    int s_index, q_index, size;
-    bool found, q_sorted = query.isSorted();
-    const nixlBasicDesc *q, *s;
-
-    resp.resize(query.descCount());
+        // 1-to-1 mapping cannot hold
+        if (query.isSorted() != resp.sorted)
+            return NIXL_ERR_INVALID_PARAM;
 
-    if (!sorted) {
-        for (int i=0; i<query.descCount(); ++i)
-            for (auto & elm : descs)
-                if (elm.covers(query[i])){
-                    *p = query[i];
-                    new_elm.copyMeta(elm);
-                    resp.descs[i]=new_elm;
-                    count++;
-                    break;
-                }
+        resp.resize(query.descCount());
 
-        if (query.descCount()==count) {
-            return NIXL_SUCCESS;
-        } else {
+        if (populate(query, resp, 0, query.descCount()) != NIXL_SUCCESS) {
             resp.clear();
             return NIXL_ERR_UNKNOWN;
         }
-    } else {
-        if (q_sorted) {
-            size = (int) descs.size();
-            s_index = 0;
-            q_index = 0;
-
-            while (q_index<query.descCount()){
-                s = &descs[s_index];
-                q = &query[q_index];
-                if ((*s).covers(*q)) {
-                    *p = *q;
-                    new_elm.copyMeta(descs[s_index]); // needs const nixlBasicDesc&
-                    resp.descs[q_index] = new_elm;
-                    q_index++;
-                } else {
-                    s_index++;
-                    // if (*q < descs[s_index]) ||
-                    if (s_index==size) {
-                        resp.clear();
-                        return NIXL_ERR_UNKNOWN;
-                    }
-                }
-            }
-
-            resp.sorted = true; // Should be redundant
-            return NIXL_SUCCESS;
 
-        } else {
-            for (int i=0; i<query.descCount(); ++i) {
-                found = false;
-                q = &query[i];
-                auto itr = std::lower_bound(descs.begin() + last_found,
-                                            descs.end(), *q);
-
-                // Same start address case
-                if (itr != descs.end()){
-                    if ((*itr).covers(*q)) {
-                        found = true;
-                    }
-                }
+        resp.sorted = query.isSorted(); // Update as resize resets it
+        return NIXL_SUCCESS;
+    }
+}
 
-                // query starts starts later, try previous entry
-                if ((!found) && (itr != descs.begin())){
-                    itr = std::prev(itr , 1);
-                    if ((*itr).covers(*q)) {
-                        found = true;
-                    }
-                }
+template <class T>
+nixl_status_t nixlDescList<T>::populate (const nixlDescList<nixlBasicDesc> &query,
+                                         nixlDescList<T> &resp,
+                                         const int &start,
+                                         const int &end) const {
+    if constexpr (std::is_same<nixlBasicDesc, T>::value) {
+        return NIXL_ERR_INVALID_PARAM;
+    } else {
+        bool found;
+
+        if ((type != query.getType()) || (type != resp.type))
+            return NIXL_ERR_INVALID_PARAM;
+
+        if ((start < 0) || (start > end) || (end > query.descCount()) ||
+            (resp.descCount() != query.descCount()))
+            return NIXL_ERR_INVALID_PARAM;
+
+        if (!sorted)
+            found = populateKernel<T, false, false>(descs, query.begin(),
+                                                    resp.descs.begin(),
+                                                    start, end);
+        else if (query.isSorted())
+            found = populateKernel<T, true, true>(descs, query.begin(),
+                                                  resp.descs.begin(),
+                                                  start, end);
+        else
+            found = populateKernel<T, true, false>(descs, query.begin(),
+                                                   resp.descs.begin(),
+                                                   start, end);
 
-                if (found) {
-                    *p = *q;
-                    new_elm.copyMeta(*itr);
-                    resp.descs[i] = new_elm;
-                } else {
-                    resp.clear();
-                    return NIXL_ERR_UNKNOWN;
-                }
-            }
-            resp.sorted = query.isSorted(); // Update as resize resets it
-            return NIXL_SUCCESS;
-        }
+        return found ? NIXL_SUCCESS : NIXL_ERR_UNKNOWN;
     }
 }
 
@@ -464,12 +493,9 @@ nixl_status_t nixlDescList<T>::serialize(nixlSerDes* serializer) const {
     size_t n_desc = descs.size();
 
     // nixlMetaDesc should be internal and not be serialized
-    if (std::is_same<nixlMetaDesc, T>::value)
-        return NIXL_ERR_INVALID_PARAM;
-
-    if (std::is_same<nixlBasicDesc, T>::value)
+    if constexpr (std::is_same<nixlBasicDesc, T>::value)
         ret = serializer->addStr("nixlDList", "nixlBDList");
-    else if (std::is_same<nixlBlobDesc, T>::value)
+    else if constexpr (std::is_same<nixlBlobDesc, T>::value)
         ret = serializer->addStr("nixlDList", "nixlSDList");
     else
         return NIXL_ERR_INVALID_PARAM;
@@ -488,7 +514,7 @@ nixl_status_t nixlDescList<T>::serialize(nixlSerDes* serializer) const {
     if (n_desc==0)
         return NIXL_SUCCESS; // Unusual, but supporting it
 
-    if (std::is_same<nixlBasicDesc, T>::value) {
+    if constexpr (std::is_same<nixlBasicDesc, T>::value) {
         // Contiguous in memory, so no need for per elm serialization
         ret = serializer->addStr("", std::string(
                                  reinterpret_cast<const char*>(descs.data()),
@@ -527,11 +553,64 @@ bool operator==(const nixlDescList<T> &lhs, const nixlDescList<T> &rhs) {
     return true;
 }
 
+/*** Class nixlDescListView implementation ***/
+
+// Views only hold a pointer to the first descriptor of the list, so nothing
+// is copied, and the element access is kept inline in the header.
+
+template <class T>
+nixlDescListView<T>::nixlDescListView (const nixl_mem_t &type) {
+    this->type    = type;
+    this->sorted  = false;
+    this->base    = nullptr;
+    this->indices = nullptr;
+    this->count   = 0;
+}
+
+template <class T>
+nixlDescListView<T>::nixlDescListView (const nixlDescList<T> &d_list) {
+    this->type    = d_list.getType();
+    this->sorted  = d_list.isSorted();
+    this->base    = d_list.isEmpty() ? nullptr : &(*d_list.begin());
+    this->indices = nullptr;
+    this->count   = d_list.descCount();
+}
+
+template <class T>
+nixlDescListView<T>::nixlDescListView (const nixlDescList<T> &d_list,
+                                       const int &start,
+                                       const int &count) {
+    if ((start < 0) || (count < 0) || (start + count > d_list.descCount()))
+        throw std::out_of_range("View range is out of range");
+
+    // A contiguous range of a sorted list remains sorted
+    this->type    = d_list.getType();
+    this->sorted  = d_list.isSorted();
+    this->base    = (count == 0) ? nullptr : &(*(d_list.begin() + start));
+    this->indices = nullptr;
+    this->count   = count;
+}
+
+template <class T>
+nixlDescListView<T>::nixlDescListView (const nixlDescList<T> &d_list,
+                                       const int* indices,
+                                       const int &count) {
+    this->type    = d_list.getType();
+    this->sorted  = false;
+    this->base    = d_list.isEmpty() ? nullptr : &(*d_list.begin());
+    this->indices = indices;
+    this->count   = count;
+}
+
 // Since we implement a template class declared in a header files, this is necessary
 template class nixlDescList<nixlBasicDesc>;
 template class nixlDescList<nixlMetaDesc>;
 template class nixlDescList<nixlBlobDesc>;
 
+template class nixlDescListView<nixlBasicDesc>;
+template class nixlDescListView<nixlMetaDesc>;
+template class nixlDescListView<nixlBlobDesc>;
+
 template bool operator==<nixlBasicDesc> (const nixlDescList<nixlBasicDesc> &lhs,
                                          const nixlDescList<nixlBasicDesc> &rhs);
 template bool operator==<nixlMetaDesc>  (const nixlDescList<nixlMetaDesc> &lhs,
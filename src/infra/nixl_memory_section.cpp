@@ -15,41 +15,293 @@
  * limitations under the License.
  */
 #include <map>
+#include <algorithm>
 #include <iostream>
 #include "nixl.h"
 #include "nixl_descriptors.h"
 #include "mem_section.h"
 #include "backend/backend_engine.h"
 #include "serdes/serdes.h"
+#include "trace.h"
 
 /*** Class nixlMemSection implementation ***/
 
 // It's pure virtual, but base also class needs a destructor due to its members.
 nixlMemSection::~nixlMemSection () {}
 
-backend_set_t* nixlMemSection::queryBackends (const nixl_mem_t &mem) {
+backend_mask_t nixlMemSection::queryBackends (const nixl_mem_t &mem) const {
     if (mem<DRAM_SEG || mem>FILE_SEG)
-        return nullptr;
+        return 0;
     else
-        return &memToBackend[mem];
+        return memToBackend[mem];
+}
+
+nixl_meta_dlist_t* nixlMemSection::addSection (const nixl_mem_t &mem,
+                                               nixlBackendEngine* backend) {
+    nixl_meta_dlist_t* &target = sectionMap[mem][backend->getId()];
+    if (!target) {
+        target = new nixl_meta_dlist_t(mem, true);
+        memToBackend[mem] |= backendBit(backend);
+        engines[backend->getId()] = backend;
+    }
+    return target;
+}
+
+void nixlMemSection::remSection (const nixl_mem_t &mem,
+                                 nixlBackendEngine* backend) {
+    nixl_meta_dlist_t* &target = sectionMap[mem][backend->getId()];
+    delete target;
+    target = nullptr;
+    memToBackend[mem] &= ~backendBit(backend);
 }
 
 nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
                                         nixlBackendEngine* backend,
                                         nixl_meta_dlist_t &resp) const {
+    NIXL_TRACE_SCOPE("populate", "nixl", query.descCount());
 
     if (query.getType() != resp.getType())
         return NIXL_ERR_INVALID_PARAM;
-    section_key_t sec_key = std::make_pair(query.getType(), backend);
-    auto it = sectionMap.find(sec_key);
-    if (it==sectionMap.end())
+    const nixl_meta_dlist_t* section = getSection(query.getType(), backend);
+    if (!section)
         return NIXL_ERR_NOT_FOUND;
     else
-        return it->second->populate(query, resp);
+        return section->populate(query, resp);
+}
+
+// Below this many descriptors per chunk, splitting costs more than it saves
+static const int minPopulateChunk = 4096;
+
+void nixlMemSection::populate (const nixl_xfer_dlist_t &query,
+                               const std::vector<nixlBackendEngine*> &backends,
+                               std::vector<nixl_meta_dlist_t*> &resps,
+                               std::vector<nixl_status_t> &rets,
+                               nixlThreadPool* pool) const {
+
+    struct populateChunk {
+        size_t                   bknd;
+        const nixl_meta_dlist_t* section;
+        int                      start;
+        int                      end;
+    };
+
+    int    desc_count = query.descCount();
+    size_t n_chunks   = 1;
+    NIXL_TRACE_SCOPE("populateBackends", "nixl", desc_count);
+
+    rets.assign(backends.size(), NIXL_SUCCESS);
+
+    if (pool)
+        n_chunks = std::min(pool->size(),
+                            (size_t) (desc_count / minPopulateChunk) + 1);
+
+    if ((n_chunks == 1) && ((backends.size() == 1) || !pool)) {
+        for (size_t b = 0; b < backends.size(); ++b)
+            rets[b] = populate(query, backends[b], *resps[b]);
+        return;
+    }
+
+    std::vector<populateChunk>  chunks;
+    std::vector<nixl_status_t>  chunk_rets;
+    int chunk_size = (desc_count + n_chunks - 1) / n_chunks;
+
+    for (size_t b = 0; b < backends.size(); ++b) {
+        nixl_meta_dlist_t &resp = *resps[b];
+        const nixl_meta_dlist_t* section = getSection(query.getType(),
+                                                      backends[b]);
+
+        if ((query.getType() != resp.getType()) ||
+            (query.isSorted() != resp.isSorted()) ||
+            (resp.descCount() != desc_count)) {
+            rets[b] = NIXL_ERR_INVALID_PARAM;
+            continue;
+        } else if (!section) {
+            rets[b] = NIXL_ERR_NOT_FOUND;
+            continue;
+        }
+
+        for (int start = 0; start < desc_count; start += chunk_size)
+            chunks.push_back({b, section, start,
+                              std::min(start + chunk_size, desc_count)});
+    }
+
+    chunk_rets.resize(chunks.size());
+    pool->parallelFor(chunks.size(), [&](size_t i) {
+        const populateChunk &c = chunks[i];
+        NIXL_TRACE_SCOPE("populateChunk", "nixl", c.end - c.start);
+        chunk_rets[i] = c.section->populate(query, *resps[c.bknd],
+                                            c.start, c.end);
+    });
+
+    for (size_t i = 0; i < chunks.size(); ++i)
+        if (chunk_rets[i] != NIXL_SUCCESS)
+            rets[chunks[i].bknd] = NIXL_ERR_UNKNOWN;
+
+    for (size_t b = 0; b < backends.size(); ++b)
+        if (rets[b] == NIXL_ERR_UNKNOWN)
+            resps[b]->clear();
 }
 
 /*** Class nixlLocalSection implementation ***/
 
+nixlLocalSection::nixlLocalSection (const size_t &reg_cache_size,
+                                    const bool &coalesce) {
+    if (reg_cache_size > 0)
+        regCache = new nixlRegCache(reg_cache_size);
+    this->coalesce = coalesce;
+}
+
+// Only plain memory ranges are merged, other types might need the metaInfo
+// of each registration
+static inline bool mergeable (const nixl_mem_t &mem) {
+    return ((mem == DRAM_SEG) || (mem == VRAM_SEG));
+}
+
+static inline bool touches (const nixlBasicDesc &a, const nixlBasicDesc &b) {
+    return ((a.devId == b.devId) &&
+            (a.addr <= b.addr + b.len) && (b.addr <= a.addr + a.len));
+}
+
+// Index of the entry of a sorted section covering desc, or negative if none
+static int findCovering (const nixl_meta_dlist_t &entries,
+                         const nixlBasicDesc &desc) {
+    auto itr = std::lower_bound(entries.begin(), entries.end(), desc);
+    if ((itr != entries.end()) && (*itr).covers(desc))
+        return itr - entries.begin();
+    if ((itr != entries.begin()) && (*std::prev(itr)).covers(desc))
+        return itr - entries.begin() - 1;
+    return NIXL_ERR_NOT_FOUND;
+}
+
+// Registers the union of desc and the entries it overlaps or is adjacent to,
+// which replaces them in the section. Nothing is registered if already covered.
+nixl_status_t nixlLocalSection::addCoalesced (const nixlBlobDesc &desc,
+                                              const nixl_mem_t &nixl_mem,
+                                              nixlBackendEngine* backend,
+                                              nixl_meta_dlist_t &target,
+                                              nixl_meta_dlist_t &remote_self) {
+    merged_map_t &regions = mergedRegions[&target];
+    const nixl_meta_dlist_t &entries = target;
+    const nixlBasicDesc &query = desc;
+    nixlMetaDesc local_meta, self_meta;
+    nixlBlobDesc merged = desc;
+    nixl_status_t ret;
+    int first, last, index;
+
+    index = findCovering(entries, query);
+    if (index >= 0) {
+        regions[entries[index]].users[query]++;
+        return NIXL_SUCCESS;
+    }
+
+    // Entries are disjoint, so the ones touching desc are consecutive and
+    // start at most one entry before it
+    first = std::lower_bound(entries.begin(), entries.end(), query) -
+            entries.begin();
+    if ((first > 0) && touches(entries[first-1], query))
+        first--;
+    for (last = first; (last < entries.descCount()) &&
+                       touches(entries[last], query); ++last) {
+        uintptr_t end = std::max(merged.addr + merged.len,
+                                 entries[last].addr + entries[last].len);
+        merged.addr = std::min(merged.addr, entries[last].addr);
+        merged.len  = end - merged.addr;
+    }
+
+    ret = registerDesc(merged, nixl_mem, backend, local_meta.metadataP);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    if (backend->supportsLocal()) {
+        ret = backend->loadLocalMD(local_meta.metadataP, self_meta.metadataP);
+        if (ret != NIXL_SUCCESS) {
+            deregisterDesc(local_meta.metadataP, backend);
+            return ret;
+        }
+    }
+
+    nixlMergedRegion region;
+    region.users[query]++;
+    for (int i = last - 1; i >= first; --i) {
+        auto it = regions.find(entries[i]);
+        for (auto & user : it->second.users)
+            region.users[user.first] += user.second;
+        region.retired.insert(region.retired.end(),
+                              it->second.retired.begin(),
+                              it->second.retired.end());
+        region.retired.push_back(entries[i].metadataP);
+        regions.erase(it);
+        target.remDesc(i);
+    }
+
+    static_cast<nixlBasicDesc&>(local_meta) = merged;
+    target.addDesc(local_meta);
+    regions[merged] = std::move(region);
+
+    if (backend->supportsLocal()) {
+        static_cast<nixlBasicDesc&>(self_meta) = merged;
+        remote_self.addDesc(self_meta);
+    }
+    return NIXL_SUCCESS;
+}
+
+// Drops one user registration, and the merged region when it was the last one
+nixl_status_t nixlLocalSection::remCoalesced (const nixlBasicDesc &desc,
+                                              nixlBackendEngine* backend,
+                                              nixl_meta_dlist_t &target) {
+    merged_map_t &regions = mergedRegions[&target];
+    const nixl_meta_dlist_t &entries = target;
+    int index = findCovering(entries, desc);
+
+    if (index < 0)
+        return NIXL_ERR_NOT_FOUND;
+    auto it = regions.find(entries[index]);
+    if (it == regions.end())
+        return NIXL_ERR_NOT_FOUND;
+    auto user = it->second.users.find(desc);
+    if (user == it->second.users.end())
+        return NIXL_ERR_NOT_FOUND;
+
+    if (--user->second == 0)
+        it->second.users.erase(user);
+    if (!it->second.users.empty())
+        return NIXL_SUCCESS;
+
+    deregisterDesc(entries[index].metadataP, backend);
+    for (auto & metadata : it->second.retired)
+        deregisterDesc(metadata, backend);
+    regions.erase(it);
+    target.remDesc(index);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlLocalSection::registerDesc (const nixlBlobDesc &desc,
+                                              const nixl_mem_t &nixl_mem,
+                                              nixlBackendEngine* backend,
+                                              nixlBackendMD* &metadata) {
+    if (regCache && nixlRegCache::cacheable(nixl_mem))
+        return regCache->acquire(desc, nixl_mem, backend, metadata);
+    return backend->registerMem(desc, nixl_mem, metadata);
+}
+
+void nixlLocalSection::deregisterDesc (nixlBackendMD* metadata,
+                                       nixlBackendEngine* backend) {
+    if (!regCache || (regCache->release(metadata) == NIXL_ERR_NOT_FOUND))
+        backend->deregisterMem(metadata);
+}
+
+nixl_status_t nixlLocalSection::releasedMem (const nixl_xfer_dlist_t &descs) {
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    if (!regCache)
+        return NIXL_SUCCESS;
+
+    for (auto & elm : descs)
+        if (regCache->invalidate(descs.getType(), elm) != NIXL_SUCCESS)
+            ret = NIXL_ERR_NOT_ALLOWED;
+    return ret;
+}
+
 nixl_reg_dlist_t nixlLocalSection::getStringDesc (
                              const nixlBackendEngine* backend,
                              const nixl_meta_dlist_t &d_list) const {
@@ -75,47 +327,75 @@ nixl_reg_dlist_t nixlLocalSection::getStringDesc (
     return output_desclist;
 }
 
+bool nixlLocalSection::registersDirectly (const nixl_mem_t &mem) const {
+    return !(regCache && nixlRegCache::cacheable(mem)) &&
+           !(coalesce && mergeable(mem));
+}
+
 // Calls into backend engine to register the memories in the desc list
 nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
                                              nixlBackendEngine* backend,
-                                             nixl_meta_dlist_t &remote_self) {
+                                             nixl_meta_dlist_t &remote_self,
+                                             const std::vector<nixlBackendMD*>* registered) {
 
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
-    // Find the MetaDesc list, or add it to the map
+    // Find the MetaDesc list, or add it to the table
     nixl_mem_t     nixl_mem     = mem_elms.getType();
-    section_key_t  sec_key      = std::make_pair(nixl_mem, backend);
+    if ((nixl_mem < DRAM_SEG) || (nixl_mem > FILE_SEG) ||
+        (registered && (!registersDirectly(nixl_mem) ||
+                        ((int) registered->size() != mem_elms.descCount()))))
+        return NIXL_ERR_INVALID_PARAM;
+    nixl_meta_dlist_t *target = addSection(nixl_mem, backend);
+    nixl_status_t ret1, ret2=NIXL_SUCCESS;
 
-    auto it = sectionMap.find(sec_key);
-    if (it==sectionMap.end()) { // New desc list
-        sectionMap[sec_key] = new nixl_meta_dlist_t(nixl_mem, true);
-        memToBackend[nixl_mem].insert(backend);
+    if (coalesce && mergeable(nixl_mem)) {
+        for (int i=0; i<mem_elms.descCount(); ++i) {
+            ret1 = addCoalesced(mem_elms[i], nixl_mem, backend, *target,
+                                remote_self);
+            if (ret1 != NIXL_SUCCESS) {
+                for (int j=0; j<i; ++j)
+                    remCoalesced(mem_elms[j], backend, *target);
+                remote_self.clear();
+                return ret1;
+            }
+        }
+        return NIXL_SUCCESS;
     }
-    nixl_meta_dlist_t *target = sectionMap[sec_key];
 
     // Add entries to the target list
     nixlMetaDesc local_meta, self_meta;
     nixlBasicDesc *lp = &local_meta;
     nixlBasicDesc *rp = &self_meta;
-    nixl_status_t ret1, ret2=NIXL_SUCCESS;
     int index;
 
     for (int i=0; i<mem_elms.descCount(); ++i) {
-        // TODO: For now trusting the user, but there can be a more checks mode
-        //       where we find overlaps and split the memories or warn the user
-        ret1 = backend->registerMem(mem_elms[i], nixl_mem, local_meta.metadataP);
+        // Trusting the user not to register overlapping memories, the
+        // coalesced mode above merges them instead
+        if (registered) {
+            local_meta.metadataP = (*registered)[i];
+            ret1 = NIXL_SUCCESS;
+        } else {
+            ret1 = registerDesc(mem_elms[i], nixl_mem, backend,
+                                local_meta.metadataP);
+        }
 
         if ((ret1==NIXL_SUCCESS) && backend->supportsLocal()) {
             ret2 = backend->loadLocalMD(local_meta.metadataP, self_meta.metadataP);
         }
 
         if ((ret1!=NIXL_SUCCESS) || (ret2!=NIXL_SUCCESS)) {
+            if (ret1==NIXL_SUCCESS)
+                deregisterDesc(local_meta.metadataP, backend);
             for (int j=0; j<i; ++j) {
                 index = target->getIndex(mem_elms[j]);
-                backend->deregisterMem
-                    ((*(const nixl_meta_dlist_t*)target)[index].metadataP);
+                deregisterDesc((*(const nixl_meta_dlist_t*)target)[index].metadataP,
+                               backend);
                 target->remDesc(index);
             }
+            if (registered)
+                for (int j=i+1; j<mem_elms.descCount(); ++j)
+                    deregisterDesc((*registered)[j], backend);
             remote_self.clear();
             if (ret1!=NIXL_SUCCESS)
                 return ret1;
@@ -144,11 +424,21 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_meta_dlist_t &mem_elms,
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
     nixl_mem_t     nixl_mem     = mem_elms.getType();
-    section_key_t sec_key = std::make_pair(nixl_mem, backend);
-    auto it = sectionMap.find(sec_key);
-    if (it==sectionMap.end())
+    nixl_meta_dlist_t *target = getSection(nixl_mem, backend);
+    if (!target)
         return NIXL_ERR_NOT_FOUND;
-    nixl_meta_dlist_t *target = it->second;
+
+    if (coalesce && mergeable(nixl_mem)) {
+        for (auto & elm : mem_elms)
+            if (remCoalesced(elm, backend, *target) != NIXL_SUCCESS)
+                return NIXL_ERR_UNKNOWN;
+
+        if (target->descCount()==0) {
+            mergedRegions.erase(target);
+            remSection(nixl_mem, backend);
+        }
+        return NIXL_SUCCESS;
+    }
 
     for (auto & elm : mem_elms) {
         int index = target->getIndex(elm);
@@ -158,38 +448,45 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_meta_dlist_t &mem_elms,
         if (index<0)
             return NIXL_ERR_UNKNOWN;
 
-        backend->deregisterMem
-            ((*(const nixl_meta_dlist_t*)target)[index].metadataP);
+        deregisterDesc((*(const nixl_meta_dlist_t*)target)[index].metadataP,
+                       backend);
         target->remDesc(index);
     }
 
-    if (target->descCount()==0) {
-        delete target;
-        sectionMap.erase(sec_key);
-        memToBackend[nixl_mem].erase(backend);
-    }
+    if (target->descCount()==0)
+        remSection(nixl_mem, backend);
 
     return NIXL_SUCCESS;
 }
 
 nixl_status_t nixlLocalSection::serialize(nixlSerDes* serializer) const {
     nixl_status_t ret;
-    size_t seg_count = sectionMap.size();
+    size_t seg_count = 0;
     nixlBackendEngine* eng;
+    backend_mask_t mask;
+
+    // Only the sections of backends with remote support are sent
+    for (auto &mem_mask : memToBackend)
+        for (mask = mem_mask; mask; )
+            if (engines[popBackend(mask)]->supportsRemote())
+                seg_count++;
 
     ret = serializer->addBuf("nixlSecElms", &seg_count, sizeof(seg_count));
     if (ret) return ret;
 
-    for (auto &seg : sectionMap) {
-        eng = seg.first.second;
-        if (!eng->supportsRemote())
-            continue;
-
-        nixl_reg_dlist_t s_desc = getStringDesc(eng, *seg.second);
-        ret = serializer->addStr("bknd", eng->getType());
-        if (ret) return ret;
-        ret = s_desc.serialize(serializer);
-        if (ret) return ret;
+    for (size_t mem = DRAM_SEG; mem <= FILE_SEG; ++mem) {
+        for (mask = memToBackend[mem]; mask; ) {
+            unsigned int id = popBackend(mask);
+            eng = engines[id];
+            if (!eng->supportsRemote())
+                continue;
+
+            nixl_reg_dlist_t s_desc = getStringDesc(eng, *sectionMap[mem][id]);
+            ret = serializer->addStr("bknd", eng->getType());
+            if (ret) return ret;
+            ret = s_desc.serialize(serializer);
+            if (ret) return ret;
+        }
     }
 
     return NIXL_SUCCESS;
@@ -199,13 +496,22 @@ nixlLocalSection::~nixlLocalSection() {
     nixl_meta_dlist_t* m_desc;
     nixlBackendEngine* eng;
 
-    for (auto &seg : sectionMap) {
-        eng    = seg.first.second;
-        m_desc = seg.second;
-        for (auto & elm : *m_desc)
-            eng->deregisterMem(elm.metadataP);
-        delete m_desc;
+    for (size_t mem = DRAM_SEG; mem <= FILE_SEG; ++mem) {
+        for (backend_mask_t mask = memToBackend[mem]; mask; ) {
+            unsigned int id = popBackend(mask);
+            eng    = engines[id];
+            m_desc = sectionMap[mem][id];
+            for (auto & elm : *m_desc)
+                deregisterDesc(elm.metadataP, eng);
+            auto merged = mergedRegions.find(m_desc);
+            if (merged != mergedRegions.end())
+                for (auto & region : merged->second)
+                    for (auto & metadata : region.second.retired)
+                        deregisterDesc(metadata, eng);
+            delete m_desc;
+        }
     }
+    delete regCache;
     // nixlMemSection destructor will clean up the rest
 }
 
@@ -218,18 +524,16 @@ nixlRemoteSection::nixlRemoteSection (const std::string &agent_name) {
 nixl_status_t nixlRemoteSection::addDescList (
                                  const nixl_reg_dlist_t& mem_elms,
                                  nixlBackendEngine* backend) {
-    if (!backend->supportsRemote())
+    if (!backend || !backend->supportsRemote())
         return NIXL_ERR_UNKNOWN;
 
     // Less checks than LocalSection, as it's private and called by loadRemoteData
     // In RemoteSection, if we support updates, value for a key gets overwritten
     // Without it, its corrupt data, we keep the last option without raising an error
     nixl_mem_t nixl_mem   = mem_elms.getType();
-    section_key_t sec_key = std::make_pair(nixl_mem, backend);
-    if (sectionMap.count(sec_key) == 0)
-        sectionMap[sec_key] = new nixl_meta_dlist_t(nixl_mem, true);
-    memToBackend[nixl_mem].insert(backend); // Fine to overwrite, it's a set
-    nixl_meta_dlist_t *target = sectionMap[sec_key];
+    if ((nixl_mem < DRAM_SEG) || (nixl_mem > FILE_SEG))
+        return NIXL_ERR_INVALID_PARAM;
+    nixl_meta_dlist_t *target = addSection(nixl_mem, backend);
 
 
     // Add entries to the target list.
@@ -284,15 +588,21 @@ nixl_status_t nixlRemoteSection::loadLocalData (
         return NIXL_ERR_UNKNOWN;
 
     nixl_mem_t     nixl_mem     = mem_elms.getType();
-    section_key_t sec_key = std::make_pair(nixl_mem, backend);
-
-    if (sectionMap.count(sec_key) == 0)
-        sectionMap[sec_key] = new nixl_meta_dlist_t(nixl_mem, true);
-    memToBackend[nixl_mem].insert(backend); // Fine to overwrite, it's a set
-    nixl_meta_dlist_t *target = sectionMap[sec_key];
-
-    for (auto & elm: mem_elms)
+    if ((nixl_mem < DRAM_SEG) || (nixl_mem > FILE_SEG))
+        return NIXL_ERR_INVALID_PARAM;
+    nixl_meta_dlist_t *target = addSection(nixl_mem, backend);
+
+    for (auto & elm: mem_elms) {
+        nixlBasicDesc start(elm.addr, 0, elm.devId);
+        int index = std::lower_bound(target->begin(), target->end(), start) -
+                    target->begin();
+        while ((index < target->descCount()) &&
+               elm.covers((*target)[index])) {
+            retired.push_back({backend, (*target)[index].metadataP});
+            target->remDesc(index);
+        }
         target->addDesc(elm);
+    }
 
     return NIXL_SUCCESS;
 }
@@ -301,12 +611,17 @@ nixlRemoteSection::~nixlRemoteSection() {
     nixl_meta_dlist_t* m_desc;
     nixlBackendEngine* eng;
 
-    for (auto &seg : sectionMap) {
-        eng    = seg.first.second;
-        m_desc = seg.second;
-        for (auto & elm : *m_desc)
-            eng->unloadMD(elm.metadataP);
-        delete m_desc;
+    for (size_t mem = DRAM_SEG; mem <= FILE_SEG; ++mem) {
+        for (backend_mask_t mask = memToBackend[mem]; mask; ) {
+            unsigned int id = popBackend(mask);
+            eng    = engines[id];
+            m_desc = sectionMap[mem][id];
+            for (auto & elm : *m_desc)
+                eng->unloadMD(elm.metadataP);
+            delete m_desc;
+        }
     }
+    for (auto & elm : retired)
+        elm.first->unloadMD(elm.second);
     // nixlMemSection destructor will clean up the rest
 }
@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "reg_cache.h"
+
+nixlRegCache::nixlRegCache (const size_t &budget) {
+    this->budget = budget;
+}
+
+// Local section releases its references before, so only idle ones are left,
+// but the rest are deregistered as well not to leak backend resources.
+nixlRegCache::~nixlRegCache () {
+    for (auto &elm : regions)
+        std::get<0>(elm.first)->deregisterMem(elm.second.metadata);
+}
+
+void nixlRegCache::evict (reg_map_t::iterator it) {
+    if (it->second.refs == 0) {
+        idleBytes -= std::get<2>(it->first).len;
+        idleLru.erase(it->second.lruIt);
+    }
+    std::get<0>(it->first)->deregisterMem(it->second.metadata);
+    mdToRegion.erase(it->second.metadata);
+    regions.erase(it);
+}
+
+void nixlRegCache::trim () {
+    while ((idleBytes > budget) && !idleLru.empty())
+        evict(regions.find(idleLru.front()));
+}
+
+nixl_status_t nixlRegCache::acquire (const nixlBlobDesc &desc,
+                                     const nixl_mem_t &mem,
+                                     nixlBackendEngine* backend,
+                                     nixlBackendMD* &metadata) {
+    nixlBasicDesc region = desc;
+    reg_key_t     key    = std::make_tuple(backend, mem, region);
+    nixl_status_t ret;
+
+    // A region covering desc is the entry at the same start with a larger
+    // length, or else one starting before it. Cached regions can overlap, so
+    // a smaller one in between does not end the search, which goes back over
+    // all the earlier regions of the same backend, memory type and device.
+    auto same_space = [&] (reg_map_t::iterator c) {
+        return ((std::get<0>(c->first) == backend) &&
+                (std::get<1>(c->first) == mem) &&
+                (std::get<2>(c->first).devId == region.devId));
+    };
+    auto it = regions.lower_bound(key);
+    reg_map_t::iterator found = regions.end();
+    if ((it != regions.end()) && same_space(it) &&
+        std::get<2>(it->first).covers(region)) {
+        found = it;
+    } else {
+        for (auto prev = it; prev != regions.begin(); ) {
+            --prev;
+            if (!same_space(prev))
+                break;
+            if (std::get<2>(prev->first).covers(region)) {
+                found = prev;
+                break;
+            }
+        }
+    }
+
+    if (found != regions.end()) {
+        if (found->second.refs == 0) {
+            idleBytes -= std::get<2>(found->first).len;
+            idleLru.erase(found->second.lruIt);
+        }
+        found->second.refs++;
+        metadata = found->second.metadata;
+        return NIXL_SUCCESS;
+    }
+
+    ret = backend->registerMem(desc, mem, metadata);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    nixlRegEntry entry;
+    entry.metadata = metadata;
+    entry.refs     = 1;
+    it = regions.emplace_hint(it, key, entry);
+    mdToRegion[metadata] = it;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlRegCache::release (nixlBackendMD* metadata) {
+    auto md_it = mdToRegion.find(metadata);
+    if (md_it == mdToRegion.end())
+        return NIXL_ERR_NOT_FOUND;
+
+    auto it = md_it->second;
+    if (--it->second.refs > 0)
+        return NIXL_SUCCESS;
+
+    if (budget == 0) {
+        evict(it);
+        return NIXL_SUCCESS;
+    }
+
+    idleLru.push_back(it->first);
+    it->second.lruIt = std::prev(idleLru.end());
+    idleBytes += std::get<2>(it->first).len;
+    trim();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlRegCache::invalidate (const nixl_mem_t &mem,
+                                        const nixlBasicDesc &range) {
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    for (auto it = regions.begin(); it != regions.end(); ) {
+        auto next = std::next(it);
+        if ((std::get<1>(it->first) == mem) &&
+            std::get<2>(it->first).overlaps(range)) {
+            if (it->second.refs == 0)
+                evict(it);
+            else
+                ret = NIXL_ERR_NOT_ALLOWED;
+        }
+        it = next;
+    }
+    return ret;
+}
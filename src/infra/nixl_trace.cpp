@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <mutex>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "trace.h"
+
+std::atomic<bool> nixlTrace::enabled{false};
+
+class nixlTraceEvent {
+    public:
+        const char*    name;
+        const char*    category;
+        nixlTime::ns_t start;
+        nixlTime::ns_t end;
+        uint64_t       arg;
+};
+
+class nixlTraceRing {
+    public:
+        // Only contended while dumping
+        std::mutex                  lock;
+        std::vector<nixlTraceEvent> events;
+        size_t                      recorded = 0;
+        long                        tid;
+
+        nixlTraceRing (const size_t &size) : events(size) {
+            tid = syscall(SYS_gettid);
+        }
+};
+
+class nixlTraceRegistry {
+    public:
+        std::mutex                                  lock;
+        std::vector<std::shared_ptr<nixlTraceRing>> rings;
+        size_t                                      ringSize = 1 << 16;
+        // From NIXL_TRACE_FILE, written at exit
+        std::string                                 exitPath;
+};
+
+static nixlTraceRegistry& getRegistry () {
+    static nixlTraceRegistry registry;
+    return registry;
+}
+
+// Rings outlive their threads through the registry, to dump exited threads
+static thread_local std::shared_ptr<nixlTraceRing> localRing;
+
+// Tracing from the environment, for the whole lifetime of the process
+class nixlTraceEnv {
+    public:
+        nixlTraceEnv () {
+            const char* path = getenv("NIXL_TRACE_FILE");
+
+            if (path && path[0]) {
+                getRegistry().exitPath = path;
+                nixlTrace::enable();
+            }
+        }
+
+        ~nixlTraceEnv () {
+            std::string path = getRegistry().exitPath;
+
+            if (!path.empty())
+                nixlTrace::dump(path);
+        }
+};
+
+static nixlTraceEnv traceEnv;
+
+void nixlTrace::enable (const size_t &ring_size) {
+    if (ring_size) {
+        nixlTraceRegistry &registry = getRegistry();
+        const std::lock_guard<std::mutex> guard(registry.lock);
+        registry.ringSize = ring_size;
+    }
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void nixlTrace::disable () {
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+void nixlTrace::record (const char* name, const char* category,
+                        const nixlTime::ns_t &start,
+                        const nixlTime::ns_t &end,
+                        const uint64_t &arg) {
+    if (!localRing) {
+        nixlTraceRegistry &registry = getRegistry();
+        const std::lock_guard<std::mutex> guard(registry.lock);
+
+        localRing = std::make_shared<nixlTraceRing>(registry.ringSize);
+        registry.rings.push_back(localRing);
+    }
+
+    const std::lock_guard<std::mutex> guard(localRing->lock);
+    nixlTraceEvent &event = localRing->events[localRing->recorded %
+                                              localRing->events.size()];
+
+    event.name     = name;
+    event.category = category;
+    event.start    = start;
+    event.end      = end;
+    event.arg      = arg;
+    localRing->recorded++;
+}
+
+nixl_status_t nixlTrace::dump (const std::string &path) {
+    nixlTraceRegistry &registry = getRegistry();
+    std::vector<nixlTraceEvent> events;
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    long pid = getpid();
+    bool first = true;
+    char buf[512];
+
+    if (!file)
+        return NIXL_ERR_BACKEND;
+
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    const std::lock_guard<std::mutex> guard(registry.lock);
+    for (auto & ring : registry.rings) {
+        long tid;
+        {
+            const std::lock_guard<std::mutex> ring_guard(ring->lock);
+            size_t size  = ring->events.size();
+            size_t count = std::min(ring->recorded, size);
+
+            // Oldest first
+            events.clear();
+            for (size_t i = ring->recorded - count; i < ring->recorded; ++i)
+                events.push_back(ring->events[i % size]);
+            tid = ring->tid;
+        }
+
+        for (auto & event : events) {
+            // Timestamps are in microseconds, with a nanosecond resolution
+            snprintf(buf, sizeof(buf),
+                     "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+                     "\"ts\":%.3f,\"dur\":%.3f,\"pid\":%ld,\"tid\":%ld,"
+                     "\"args\":{\"n\":%lu}}",
+                     first ? "" : ",", event.name, event.category,
+                     event.start / 1e3, (event.end - event.start) / 1e3,
+                     pid, tid, (unsigned long) event.arg);
+            file << buf;
+            first = false;
+        }
+    }
+
+    file << "\n]}\n";
+    file.close();
+    return file ? NIXL_SUCCESS : NIXL_ERR_BACKEND;
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __REG_CACHE_H
+#define __REG_CACHE_H
+
+#include <list>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+#include "nixl_descriptors.h"
+#include "backend/backend_engine.h"
+
+// Registration (pin-down) cache of a local section. Repeated registrations of
+// a region, or of a part of it, reuse the backend metadata of that region with
+// reference counting. When the last reference is released the registration is
+// kept idle in LRU order within a byte budget, so a later registration of the
+// same memory does not go to the backend. Only DRAM and VRAM are cached.
+class nixlRegCache {
+    private:
+        typedef std::tuple<nixlBackendEngine*, nixl_mem_t, nixlBasicDesc> reg_key_t;
+
+        class nixlRegEntry {
+            public:
+                nixlBackendMD*                  metadata;
+                int                             refs;
+                std::list<reg_key_t>::iterator  lruIt;
+        };
+
+        typedef std::map<reg_key_t, nixlRegEntry> reg_map_t;
+
+        size_t                                           budget;
+        size_t                                           idleBytes = 0;
+        reg_map_t                                        regions;
+        std::unordered_map<nixlBackendMD*,
+                           reg_map_t::iterator>          mdToRegion;
+        std::list<reg_key_t>                             idleLru; // Oldest first
+
+        void evict (reg_map_t::iterator it);
+        void trim ();
+
+    public:
+        nixlRegCache (const size_t &budget);
+        ~nixlRegCache ();
+
+        static inline bool cacheable (const nixl_mem_t &mem) {
+            return ((mem == DRAM_SEG) || (mem == VRAM_SEG));
+        }
+
+        // Outputs backend metadata covering desc, registering it if needed
+        nixl_status_t acquire (const nixlBlobDesc &desc,
+                               const nixl_mem_t &mem,
+                               nixlBackendEngine* backend,
+                               nixlBackendMD* &metadata);
+
+        // Drops a reference of metadata from acquire. Returns NIXL_ERR_NOT_FOUND
+        // if the metadata was not registered through the cache.
+        nixl_status_t release (nixlBackendMD* metadata);
+
+        // Memory in the range is being freed, so idle registrations overlapping
+        // it are deregistered. Returns NIXL_ERR_NOT_ALLOWED if an overlapping
+        // registration is still in use.
+        nixl_status_t invalidate (const nixl_mem_t &mem,
+                                  const nixlBasicDesc &range);
+
+        size_t getIdleBytes () const { return idleBytes; }
+};
+
+#endif
@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#include <atomic>
+#include <string>
+#include "nixl_types.h"
+#include "common/nixl_time.h"
+
+// Process wide timeline tracing of the transfer pipeline, dumped in the Chrome
+// trace event format (chrome://tracing, Perfetto). Each thread records spans in
+// its own ring buffer, so tracing does not synchronize threads, and only the
+// most recent spans of each thread are kept. Span names and categories must be
+// string literals, as only the pointers are recorded. When tracing is disabled
+// a span costs a relaxed load and a branch.
+//
+// Tracing is enabled through nixlAgentConfig::enableTracing, or by setting the
+// NIXL_TRACE_FILE environment variable, in which case the trace is written to
+// that file when the process exits.
+class nixlTrace {
+    private:
+        static std::atomic<bool> enabled;
+
+    public:
+        static inline bool isEnabled () {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        // ring_size is the number of spans kept per thread, for the rings of
+        // threads tracing for the first time
+        static void enable (const size_t &ring_size = 0);
+        static void disable ();
+
+        static void record (const char* name, const char* category,
+                            const nixlTime::ns_t &start,
+                            const nixlTime::ns_t &end,
+                            const uint64_t &arg);
+
+        // Writes the spans of all the threads, including exited ones
+        static nixl_status_t dump (const std::string &path);
+};
+
+// Records a span from its construction to its destruction. arg is shown in
+// the trace as "n", e.g., for a descriptor or byte count.
+class nixlTraceSpan {
+    private:
+        const char*    name;
+        const char*    category;
+        uint64_t       arg;
+        nixlTime::ns_t start;
+
+    public:
+        inline nixlTraceSpan (const char* name, const char* category,
+                              const uint64_t &arg = 0) :
+                              name(name), category(category), arg(arg) {
+            start = nixlTrace::isEnabled() ? nixlTime::getNs() : 0;
+        }
+
+        inline ~nixlTraceSpan () {
+            if (start)
+                nixlTrace::record(name, category, start, nixlTime::getNs(), arg);
+        }
+
+        inline void setArg (const uint64_t &new_arg) { arg = new_arg; }
+};
+
+#define NIXL_TRACE_CONCAT_(a, b) a##b
+#define NIXL_TRACE_CONCAT(a, b)  NIXL_TRACE_CONCAT_(a, b)
+
+// Traces the rest of the enclosing scope, arguments are the ones of nixlTraceSpan
+#define NIXL_TRACE_SCOPE(...) \
+    nixlTraceSpan NIXL_TRACE_CONCAT(_nixl_span_, __LINE__)(__VA_ARGS__)
+
+#endif
@@ -99,6 +99,7 @@ nixl_status_t nixlGdsIOBatch::cancelBatch()
 nixl_status_t nixlGdsIOBatch::submitBatch(int flags)
 {
     CUfileError_t   err;
+    NIXL_TRACE_SCOPE("gds.batchSubmit", "gds", batch_size);
 
     err = cuFileBatchIOSubmit(batch_handle, batch_size,
                               io_batch_params, flags);
@@ -106,6 +107,7 @@ nixl_status_t nixlGdsIOBatch::submitBatch(int flags)
         std::cerr << "Error in setting up Batch\n" << std::endl;
         return NIXL_ERR_BACKEND;
     }
+    submit_time = nixlTrace::isEnabled() ? nixlTime::getNs() : 0;
     return NIXL_SUCCESS;
 }
 
@@ -129,12 +131,19 @@ nixl_status_t nixlGdsIOBatch::checkStatus()
     else
         current_status = NIXL_SUCCESS;
 
+    if ((current_status != NIXL_IN_PROG) && submit_time) {
+        nixlTrace::record("gds.batch", "gds", submit_time,
+                          nixlTime::getNs(), batch_size);
+        submit_time = 0;
+    }
+
     return current_status;
 }
 
 void nixlGdsIOBatch::reset() {
     entries_completed = 0;
     batch_size = 0;
+    submit_time = 0;
     current_status = NIXL_ERR_NOT_POSTED;
 }
 
@@ -200,6 +209,7 @@ nixl_status_t nixlGdsEngine::registerMem (const nixlBlobDesc &mem,
     nixlGdsMetadata *md  = new nixlGdsMetadata();
 
     if (nixl_mem == FILE_SEG) {
+        std::lock_guard<std::mutex> lk(gds_file_map_lock);
         // if the same file is reused - no need to re-register
         auto it = gds_file_map.find(mem.devId);
         if (it != gds_file_map.end()) {
@@ -259,8 +269,8 @@ nixl_status_t nixlGdsEngine::deregisterMem (nixlBackendMD* meta)
 }
 
 nixl_status_t nixlGdsEngine::prepXfer (const nixl_xfer_op_t &operation,
-                                       const nixl_meta_dlist_t &local,
-                                       const nixl_meta_dlist_t &remote,
+                                       const nixl_meta_dview_t &local,
+                                       const nixl_meta_dview_t &remote,
                                        const std::string &remote_agent,
                                        nixlBackendReqH* &handle,
                                        const nixl_opt_b_args_t* opt_args)
@@ -304,8 +314,8 @@ void nixlGdsEngine::returnBatchToPool(nixlGdsIOBatch* batch) {
 }
 
 nixl_status_t nixlGdsEngine::postXfer (const nixl_xfer_op_t &operation,
-                                       const nixl_meta_dlist_t &local,
-                                       const nixl_meta_dlist_t &remote,
+                                       const nixl_meta_dview_t &local,
+                                       const nixl_meta_dview_t &remote,
                                        const std::string &remote_agent,
                                        nixlBackendReqH* &handle,
                                        const nixl_opt_b_args_t* opt_args)
@@ -427,8 +437,8 @@ nixlGdsEngine::~nixlGdsEngine() {
 
 // Add helper function to create batches that can be called from both prepXfer and postXfer
 nixl_status_t nixlGdsEngine::createBatches(const nixl_xfer_op_t &operation,
-                                           const nixl_meta_dlist_t &local,
-                                           const nixl_meta_dlist_t &remote,
+                                           const nixl_meta_dview_t &local,
+                                           const nixl_meta_dview_t &remote,
                                            nixlGdsBackendReqH* gds_handle) {
     size_t buf_cnt = local.descCount();
     size_t file_cnt = remote.descCount();
@@ -456,6 +466,7 @@ nixl_status_t nixlGdsEngine::createBatches(const nixl_xfer_op_t &operation,
     gds_handle->batch_io_list.clear();
 
     // Create list of all transfer requests
+    std::unique_lock<std::mutex> lk(gds_file_map_lock);
     for (size_t i = 0; i < buf_cnt; i++) {
         void* base_addr;
         size_t total_size;
@@ -508,6 +519,7 @@ nixl_status_t nixlGdsEngine::createBatches(const nixl_xfer_op_t &operation,
             current_offset += request_size;
         }
     }
+    lk.unlock();
 
     // Create and prepare batches
     size_t current_req = 0;
@@ -24,9 +24,11 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <list>
+#include <mutex>
 #include <vector>
 #include "gds_utils.h"
 #include "backend/backend_engine.h"
+#include "trace.h"
 
 class nixlGdsMetadata : public nixlBackendMD {
     public:
@@ -48,6 +50,8 @@ class nixlGdsIOBatch {
         nixl_status_t current_status{NIXL_ERR_NOT_POSTED};
         unsigned int entries_completed{0};
         unsigned int batch_size{0};
+        // When traced, the batch is a span from submission to completion
+        nixlTime::ns_t submit_time{0};
 
     public:
         nixlGdsIOBatch(unsigned int size);
@@ -91,6 +95,9 @@ class nixlGdsBackendReqH : public nixlBackendReqH {
 class nixlGdsEngine : public nixlBackendEngine {
     private:
         gdsUtil *gds_utils;
+        // Registration can run on registerMemAsync workers, while transfers
+        // are prepared on the agent thread
+        std::mutex gds_file_map_lock;
         std::unordered_map<int, gdsFileHandle> gds_file_map;
         std::list<nixlGdsIOBatch*> batch_pool;
         unsigned int batch_pool_size;  // Renamed from pool_size
@@ -100,8 +107,8 @@ class nixlGdsEngine : public nixlBackendEngine {
         nixlGdsIOBatch* getBatchFromPool(unsigned int size);
         void returnBatchToPool(nixlGdsIOBatch* batch);
         nixl_status_t createBatches(const nixl_xfer_op_t &operation,
-                                   const nixl_meta_dlist_t &local,
-                                   const nixl_meta_dlist_t &remote,
+                                   const nixl_meta_dview_t &local,
+                                   const nixl_meta_dview_t &remote,
                                    nixlGdsBackendReqH* gds_handle);
 
     public:
@@ -123,6 +130,10 @@ class nixlGdsEngine : public nixlBackendEngine {
         bool supportsProgTh() const {
             return false;
         }
+        // cuFile registrations are thread safe, and the file map is locked
+        bool supportsParallelReg() const {
+            return true;
+        }
 
         nixl_mem_list_t getSupportedMems() const {
             nixl_mem_list_t mems;
@@ -155,15 +166,15 @@ class nixlGdsEngine : public nixlBackendEngine {
         nixl_status_t deregisterMem(nixlBackendMD *meta);
 
         nixl_status_t prepXfer(const nixl_xfer_op_t &operation,
-                              const nixl_meta_dlist_t &local,
-                              const nixl_meta_dlist_t &remote,
+                              const nixl_meta_dview_t &local,
+                              const nixl_meta_dview_t &remote,
                               const std::string &remote_agent,
                               nixlBackendReqH* &handle,
                               const nixl_opt_b_args_t* opt_args=nullptr);
 
         nixl_status_t postXfer(const nixl_xfer_op_t &operation,
-                              const nixl_meta_dlist_t &local,
-                              const nixl_meta_dlist_t &remote,
+                              const nixl_meta_dview_t &local,
+                              const nixl_meta_dview_t &remote,
                               const std::string &remote_agent,
                               nixlBackendReqH* &handle,
                               const nixl_opt_b_args_t* opt_args=nullptr);
@@ -334,6 +334,11 @@ nixl_mem_list_t nixlUcxEngine::getSupportedMems () const {
     return mems;
 }
 
+void nixlUcxEngine::getCounters (std::map<std::string, uint64_t> &counters) const {
+    counters["progress_iterations"] = uw->getProgressCount();
+    counters["rkeys_imported"]      = rkeysImported.load(std::memory_order_relaxed);
+}
+
 // Through parent destructor the unregister will be called.
 nixlUcxEngine::~nixlUcxEngine () {
     // per registered memory deregisters it, which removes the corresponding metadata too
@@ -575,7 +580,10 @@ nixl_status_t nixlUcxEngine::registerMem (const nixlBlobDesc &mem,
     }
 
     // TODO: Add nixl_mem check?
-    ret = uw->memReg((void*) mem.addr, mem.len, priv->mem);
+    {
+        NIXL_TRACE_SCOPE("ucx.memReg", "ucx", mem.len);
+        ret = uw->memReg((void*) mem.addr, mem.len, priv->mem);
+    }
     if (ret) {
         return NIXL_ERR_BACKEND;
     }
@@ -629,11 +637,13 @@ nixlUcxEngine::internalMDHelper (const nixl_blob_t &blob,
     char *addr = new char[size];
     nixlSerDes::_stringToBytes(addr, blob, size);
 
+    NIXL_TRACE_SCOPE("ucx.rkeyImport", "ucx", size);
     int ret = uw->rkeyImport(conn.ep, addr, size, md->rkey);
     if (ret) {
         // TODO: error out. Should we indicate which desc failed or unroll everything prior
         return NIXL_ERR_BACKEND;
     }
+    rkeysImported.fetch_add(1, std::memory_order_relaxed);
     output = (nixlBackendMD*) md;
 
     delete[] addr;
@@ -693,8 +703,8 @@ nixl_status_t nixlUcxEngine::retHelper(nixl_status_t ret, nixlUcxBckndReq *head,
 }
 
 nixl_status_t nixlUcxEngine::prepXfer (const nixl_xfer_op_t &operation,
-                                       const nixl_meta_dlist_t &local,
-                                       const nixl_meta_dlist_t &remote,
+                                       const nixl_meta_dview_t &local,
+                                       const nixl_meta_dview_t &remote,
                                        const std::string &remote_agent,
                                        nixlBackendReqH* &handle,
                                        const nixl_opt_b_args_t* opt_args)
@@ -704,8 +714,8 @@ nixl_status_t nixlUcxEngine::prepXfer (const nixl_xfer_op_t &operation,
 }
 
 nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
-                                       const nixl_meta_dlist_t &local,
-                                       const nixl_meta_dlist_t &remote,
+                                       const nixl_meta_dview_t &local,
+                                       const nixl_meta_dview_t &remote,
                                        const std::string &remote_agent,
                                        nixlBackendReqH* &handle,
                                        const nixl_opt_b_args_t* opt_args)
@@ -740,12 +750,16 @@ nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
         // TODO: remote_agent and msg should be cached in nixlUCxReq or another way
 
         switch (operation) {
-        case NIXL_READ:
+        case NIXL_READ: {
+            NIXL_TRACE_SCOPE("ucx.get", "ucx", lsize);
             ret = uw->read(rmd->conn.ep, (uint64_t) raddr, rmd->rkey, laddr, lmd->mem, lsize, req);
             break;
-        case NIXL_WRITE:
+        }
+        case NIXL_WRITE: {
+            NIXL_TRACE_SCOPE("ucx.put", "ucx", lsize);
             ret = uw->write(rmd->conn.ep, laddr, lmd->mem, (uint64_t) raddr, rmd->rkey, lsize, req);
             break;
+        }
         default:
             return NIXL_ERR_INVALID_PARAM;
         }
@@ -756,18 +770,27 @@ nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
     }
 
     rmd = (nixlUcxPublicMetadata*) remote[0].metadataP;
-    ret = uw->flushEp(rmd->conn.ep, req);
+    {
+        NIXL_TRACE_SCOPE("ucx.flush", "ucx");
+        ret = uw->flushEp(rmd->conn.ep, req);
+    }
     if (retHelper(ret, head, req)) {
         return ret;
     }
 
+    // The remote metadata carries the connection, no need to look it up by name
     if(opt_args && opt_args->hasNotif) {
-        ret = notifSendPriv(remote_agent, opt_args->notifMsg, req);
+        ret = notifSendPriv(rmd->conn.ep, opt_args->notifMsg, req);
         if (retHelper(ret, head, req)) {
             return ret;
         }
     }
 
+    // Get high priority transfers going (e.g. rendezvous handshakes) right
+    // away, instead of at the next check or progress thread iteration
+    if (opt_args && (opt_args->priority == NIXL_PRIO_HIGH) && head->next())
+        uw->progress();
+
     handle = head->next();
     return (NULL ==  head->next()) ? NIXL_SUCCESS : NIXL_IN_PROG;
 }
@@ -861,25 +884,16 @@ int nixlUcxEngine::progress() {
 *****************************************/
 
 //agent will provide cached msg
-nixl_status_t nixlUcxEngine::notifSendPriv(const std::string &remote_agent,
+nixl_status_t nixlUcxEngine::notifSendPriv(nixlUcxEp &ep,
                                            const std::string &msg, nixlUcxReq &req)
 {
     nixlSerDes ser_des;
     std::string *ser_msg;
-    nixlUcxConnection conn;
     // TODO - temp fix, need to have an mpool
     static struct nixl_ucx_am_hdr hdr;
     uint32_t flags = 0;
     nixl_status_t ret;
-
-    auto search = remoteConnMap.find(remote_agent);
-
-    if(search == remoteConnMap.end()) {
-        //TODO: err: remote connection not found
-        return NIXL_ERR_NOT_FOUND;
-    }
-
-    conn = remoteConnMap[remote_agent];
+    NIXL_TRACE_SCOPE("ucx.notifSend", "ucx", msg.size());
 
     hdr.op = NOTIF_STR;
     flags |= UCP_AM_SEND_FLAG_EAGER;
@@ -889,7 +903,7 @@ nixl_status_t nixlUcxEngine::notifSendPriv(const std::string &remote_agent,
     // TODO: replace with mpool for performance
     ser_msg = new std::string(ser_des.exportStr());
 
-    ret = uw->sendAm(conn.ep, NOTIF_STR,
+    ret = uw->sendAm(ep, NOTIF_STR,
                      &hdr, sizeof(struct nixl_ucx_am_hdr),
                      (void*) ser_msg->data(), ser_msg->size(),
                      flags, req);
@@ -909,6 +923,7 @@ nixlUcxEngine::notifAmCb(void *arg, const void *header,
 {
     struct nixl_ucx_am_hdr* hdr = (struct nixl_ucx_am_hdr*) header;
     nixlSerDes ser_des;
+    NIXL_TRACE_SCOPE("ucx.notifRecv", "ucx", length);
 
     std::string ser_str( (char*) data, length);
     nixlUcxEngine* engine = (nixlUcxEngine*) arg;
@@ -986,7 +1001,14 @@ nixl_status_t nixlUcxEngine::genNotif(const std::string &remote_agent, const std
     nixl_status_t ret;
     nixlUcxReq req;
 
-    ret = notifSendPriv(remote_agent, msg, req);
+    auto search = remoteConnMap.find(remote_agent);
+
+    if(search == remoteConnMap.end()) {
+        //TODO: err: remote connection not found
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    ret = notifSendPriv(search->second.ep, msg, req);
 
     switch(ret) {
     case NIXL_IN_PROG:
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <thread>
 #include <mutex>
+#include <atomic>
 
 #include "nixl.h"
 #include "backend/backend_engine.h"
@@ -31,6 +32,7 @@
 #include "common/nixl_time.h"
 #include "ucx/ucx_utils.h"
 #include "common/list_elem.h"
+#include "trace.h"
 
 typedef enum {CONN_CHECK, NOTIF_STR, DISCONNECT} ucx_cb_op_t;
 
@@ -114,6 +116,9 @@ class nixlUcxEngine : public nixlBackendEngine {
         std::mutex  notifMtx;
         notif_list_t notifPthrPriv, notifPthr;
 
+        // Telemetry, rkeys imported for remote and loopback metadata
+        std::atomic<uint64_t> rkeysImported{0};
+
         // Map of agent name to saved nixlUcxConnection info
         std::unordered_map<std::string, nixlUcxConnection,
                            std::hash<std::string>, strEqual> remoteConnMap;
@@ -185,7 +190,7 @@ class nixlUcxEngine : public nixlBackendEngine {
                                       size_t header_length, void *data,
                                       size_t length,
                                       const ucp_am_recv_param_t *param);
-        nixl_status_t notifSendPriv(const std::string &remote_agent,
+        nixl_status_t notifSendPriv(nixlUcxEp &ep,
                                     const std::string &msg, nixlUcxReq &req);
         void notifProgress();
         void notifCombineHelper(notif_list_t &src, notif_list_t &tgt);
@@ -206,6 +211,8 @@ class nixlUcxEngine : public nixlBackendEngine {
 
         nixl_mem_list_t getSupportedMems () const;
 
+        void getCounters (std::map<std::string, uint64_t> &counters) const;
+
         /* Object management */
         nixl_status_t getPublicData (const nixlBackendMD* meta,
                                      std::string &str) const;
@@ -232,15 +239,15 @@ class nixlUcxEngine : public nixlBackendEngine {
 
         // Data transfer
         nixl_status_t prepXfer (const nixl_xfer_op_t &operation,
-                                const nixl_meta_dlist_t &local,
-                                const nixl_meta_dlist_t &remote,
+                                const nixl_meta_dview_t &local,
+                                const nixl_meta_dview_t &remote,
                                 const std::string &remote_agent,
                                 nixlBackendReqH* &handle,
                                 const nixl_opt_b_args_t* opt_args=nullptr);
 
         nixl_status_t postXfer (const nixl_xfer_op_t &operation,
-                                const nixl_meta_dlist_t &local,
-                                const nixl_meta_dlist_t &remote,
+                                const nixl_meta_dview_t &local,
+                                const nixl_meta_dview_t &remote,
                                 const std::string &remote_agent,
                                 nixlBackendReqH* &handle,
                                 const nixl_opt_b_args_t* opt_args=nullptr);
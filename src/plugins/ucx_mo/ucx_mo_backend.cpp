@@ -223,8 +223,9 @@ nixlUcxMoEngine::loadRemoteConnInfo (const string  &remote_agent,
     for(size_t idx = 0; idx < sz; idx++) {
         string cinfo;
         cinfo = sd.getStr("Value");
+        conn.engNames.push_back(getEngName(remote_agent, idx));
         for (auto &e : engines) {
-            status = e->loadRemoteConnInfo(getEngName(remote_agent, idx), cinfo);
+            status = e->loadRemoteConnInfo(conn.engNames[idx], cinfo);
             if (status != NIXL_SUCCESS) {
                 return status;
             }
@@ -250,7 +251,7 @@ nixlUcxMoEngine::connect(const string &remote_agent)
 
     for (auto &e : engines) {
         for (uint32_t idx = 0; idx < conn.num_engines; idx++) {
-            status = e->connect(getEngName(remote_agent, idx));
+            status = e->connect(conn.engNames[idx]);
             if (status != NIXL_SUCCESS) {
                 return status;
             }
@@ -274,7 +275,7 @@ nixlUcxMoEngine::disconnect(const string &remote_agent)
 
     for (auto &e : engines) {
         for (uint32_t idx = 0; idx < conn.num_engines; idx++) {
-            status = e->disconnect(getEngName(remote_agent, idx));
+            status = e->disconnect(conn.engNames[idx]);
             if (status != NIXL_SUCCESS) {
                 return status;
             }
@@ -466,8 +467,8 @@ nixlUcxMoEngine::retHelper(nixl_status_t ret, nixlBackendEngine *eng,
 
 nixl_status_t
 nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
-                           const nixl_meta_dlist_t &local,
-                           const nixl_meta_dlist_t &remote,
+                           const nixl_meta_dview_t &local,
+                           const nixl_meta_dview_t &remote,
                            const std::string &remote_agent,
                            nixlBackendReqH* &handle,
                            const nixl_opt_b_args_t *opt_args)
@@ -499,6 +500,7 @@ nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
     size_t r_eng_cnt = conn.num_engines;
 
     nixlUcxMoRequestH *req = new nixlUcxMoRequestH(l_eng_cnt, r_eng_cnt);
+    req->remoteEngNames = conn.engNames;
 
     /* Go over all input */
     for(int i = 0; i < des_cnt; i++) {
@@ -553,8 +555,8 @@ error:
 // Data transfer
 nixl_status_t
 nixlUcxMoEngine::postXfer (const nixl_xfer_op_t &operation,
-                           const nixl_meta_dlist_t &local,
-                           const nixl_meta_dlist_t &remote,
+                           const nixl_meta_dview_t &local,
+                           const nixl_meta_dview_t &remote,
                            const std::string &remote_agent,
                            nixlBackendReqH* &handle,
                            const nixl_opt_b_args_t *opt_args)
@@ -574,7 +576,7 @@ nixlUcxMoEngine::postXfer (const nixl_xfer_op_t &operation,
             ret = engines[lidx]->postXfer(operation,
                                           *req->dlMatrix[lidx][ridx].first,
                                           *req->dlMatrix[lidx][ridx].second,
-                                          getEngName(remote_agent, ridx),
+                                          req->remoteEngNames[ridx],
                                           int_req);
             ret = retHelper(ret, engines[lidx], req, int_req);
             if (NIXL_SUCCESS != ret) {
@@ -591,7 +593,6 @@ nixlUcxMoEngine::postXfer (const nixl_xfer_op_t &operation,
         // Instead, we will initiate Notification from the CheckXfer
         req->notifNeed = true;
         req->notifMsg = opt_args->notifMsg;
-        req->remoteAgent = remote_agent;
     }
 
     if (req->reqs.size()) {
@@ -635,7 +636,7 @@ nixlUcxMoEngine::checkXfer (nixlBackendReqH *handle)
 
         // Now as all UCX backends (workers) have been flushed,
         // it is safe to send Notification
-        ret = engines[0]->genNotif(getEngName(req->remoteAgent, 0), req->notifMsg);
+        ret = engines[0]->genNotif(req->remoteEngNames[0], req->notifMsg);
         if (NIXL_SUCCESS != ret) {
             /* Mark as completed */
             return ret;
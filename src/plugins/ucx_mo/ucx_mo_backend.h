@@ -36,6 +36,8 @@ class nixlUcxMoConnection : public nixlBackendConnMD {
     private:
         std::string remoteAgent;
         uint32_t num_engines;
+        // Names of the remote engines in the internal UCX engines, built once
+        std::vector<std::string> engNames;
 
     public:
         // Extra information required for UCX connections
@@ -94,7 +96,8 @@ private:
     dl_matrix_t dlMatrix;
     req_list_t reqs;
 
-    std::string remoteAgent;
+    // Remote engine names, copied at prepXfer so posts don't build strings
+    std::vector<std::string> remoteEngNames;
     bool notifNeed;
     std::string notifMsg;
 public:
@@ -200,15 +203,15 @@ public:
 
     // Data transfer
     nixl_status_t prepXfer (const nixl_xfer_op_t &operation,
-                            const nixl_meta_dlist_t &local,
-                            const nixl_meta_dlist_t &remote,
+                            const nixl_meta_dview_t &local,
+                            const nixl_meta_dview_t &remote,
                             const std::string &remote_agent,
                             nixlBackendReqH* &handle,
                             const nixl_opt_b_args_t* opt_args=nullptr);
 
     nixl_status_t postXfer (const nixl_xfer_op_t &operation,
-                            const nixl_meta_dlist_t &local,
-                            const nixl_meta_dlist_t &remote,
+                            const nixl_meta_dview_t &local,
+                            const nixl_meta_dview_t &remote,
                             const std::string &remote_agent,
                             nixlBackendReqH* &handle,
                             const nixl_opt_b_args_t* opt_args=nullptr);
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_THREAD_POOL_H
+#define _NIXL_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small fixed size pool to split a loop over several threads. The calling
+// thread takes part in the work, so a pool of size N spawns N-1 workers.
+// Concurrent parallelFor calls are serialized, and func should not call back
+// into the same pool. Tasks can also be queued to run on the workers alone,
+// and they may queue more tasks.
+class nixlThreadPool {
+    private:
+        std::vector<std::thread> workers;
+
+        std::mutex               runLock;   // One parallelFor at a time
+        std::mutex               lock;
+        std::condition_variable  startCv;
+        std::condition_variable  doneCv;
+
+        const std::function<void(size_t)>* job = nullptr;
+        size_t                   jobCount   = 0;
+        std::atomic<size_t>      nextIdx{0};
+        uint64_t                 generation = 0;
+        size_t                   pending    = 0; // Workers yet to finish the job
+        bool                     stop       = false;
+        // Run when no parallelFor job is waiting, dropped if still queued
+        // when the pool is destroyed
+        std::deque<std::function<void()>> tasks;
+
+        void runJob(const std::function<void(size_t)> &func, const size_t count) {
+            size_t idx;
+            while ((idx = nextIdx.fetch_add(1, std::memory_order_relaxed)) < count)
+                func(idx);
+        }
+
+        void workerLoop() {
+            uint64_t seen = 0;
+            std::unique_lock<std::mutex> lk(lock);
+            while (true) {
+                startCv.wait(lk, [&] {
+                    return stop || (generation != seen) || !tasks.empty();
+                });
+                if (stop)
+                    return;
+
+                if (generation == seen) {
+                    std::function<void()> task = std::move(tasks.front());
+                    tasks.pop_front();
+                    lk.unlock();
+                    task();
+                    lk.lock();
+                    continue;
+                }
+
+                seen = generation;
+                const std::function<void(size_t)>* func = job;
+                size_t count = jobCount;
+                lk.unlock();
+
+                runJob(*func, count);
+
+                lk.lock();
+                if (--pending == 0)
+                    doneCv.notify_one();
+            }
+        }
+
+    public:
+        nixlThreadPool(const size_t num_threads) {
+            for (size_t i = 1; i < num_threads; ++i)
+                workers.emplace_back(&nixlThreadPool::workerLoop, this);
+        }
+
+        nixlThreadPool(const nixlThreadPool&) = delete;
+        nixlThreadPool& operator=(const nixlThreadPool&) = delete;
+
+        ~nixlThreadPool() {
+            {
+                std::lock_guard<std::mutex> lk(lock);
+                stop = true;
+            }
+            startCv.notify_all();
+            for (auto &t : workers)
+                t.join();
+        }
+
+        // Number of threads taking part in a parallelFor, including the caller
+        size_t size() const { return workers.size() + 1; }
+
+        // Queues task and returns right away. The pool needs workers, that is
+        // a size of at least 2, and a parallelFor waits for the tasks they run.
+        void submit(std::function<void()> task) {
+            {
+                std::lock_guard<std::mutex> lk(lock);
+                tasks.push_back(std::move(task));
+            }
+            startCv.notify_one();
+        }
+
+        // Calls func(i) for every i in [0, count) and returns when all are done
+        void parallelFor(const size_t count, const std::function<void(size_t)> &func) {
+            if (count == 0)
+                return;
+
+            if ((count == 1) || workers.empty()) {
+                for (size_t i = 0; i < count; ++i)
+                    func(i);
+                return;
+            }
+
+            std::lock_guard<std::mutex> run_guard(runLock);
+            {
+                std::lock_guard<std::mutex> lk(lock);
+                job      = &func;
+                jobCount = count;
+                pending  = workers.size();
+                nextIdx.store(0, std::memory_order_relaxed);
+                generation++;
+            }
+            startCv.notify_all();
+
+            runJob(func, count);
+
+            // Every worker checks in, even if it woke up after all the work was
+            // taken, so none of them can still see func after we return.
+            std::unique_lock<std::mutex> lk(lock);
+            doneCv.wait(lk, [&] { return pending == 0; });
+            job = nullptr;
+        }
+};
+
+#endif
@@ -418,6 +418,7 @@ int nixlUcxWorker::getRndvData(void* data_desc, void* buffer, size_t len, const
 
 int nixlUcxWorker::progress()
 {
+    progressCount.fetch_add(1, std::memory_order_relaxed);
     return ucp_worker_progress(worker);
 }
 
@@ -479,6 +480,7 @@ nixl_status_t nixlUcxWorker::test(nixlUcxReq req)
         return NIXL_SUCCESS;
     }
 
+    progressCount.fetch_add(1, std::memory_order_relaxed);
     ucp_worker_progress(worker);
     status = ucp_request_check_status(req);
     if (status == UCS_INPROGRESS) {
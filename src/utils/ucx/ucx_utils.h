@@ -22,6 +22,7 @@ extern "C"
 #include <ucp/api/ucp.h>
 }
 
+#include <atomic>
 #include "nixl.h"
 
 typedef enum {
@@ -82,6 +83,9 @@ private:
     nixlUcxContext *ctx;
     ucp_worker_h worker;
 
+    /* Progress calls for telemetry, can be read from any thread */
+    std::atomic<uint64_t> progressCount{0};
+
 public:
     nixlUcxWorker(nixlUcxContext *ctx);
     ~nixlUcxWorker();
@@ -122,6 +126,9 @@ public:
                         uint64_t raddr, nixlUcxRkey &rk,
                         size_t size, nixlUcxReq &req);
     nixl_status_t test(nixlUcxReq req);
+    uint64_t getProgressCount() const {
+        return progressCount.load(std::memory_order_relaxed);
+    }
 
     void reqRelease(nixlUcxReq req);
     void reqCancel(nixlUcxReq req);
@@ -362,11 +362,15 @@ int main()
     // with separate memory regions in DRAM
 
     nixlAgentConfig cfg(true);
+    nixlAgentConfig cfg1(cfg);
     nixl_b_params_t init1, init2;
     nixl_mem_list_t mems1, mems2;
 
+    // Initiator memoizes its createXferReq preparations
+    cfg1.xferCacheSize = 16;
+
     // populate required/desired inits
-    nixlAgent A1(agent1, cfg);
+    nixlAgent A1(agent1, cfg1);
     nixlAgent A2(agent2, cfg);
 
     std::vector<nixl_backend_t> plugins;
@@ -527,6 +531,22 @@ int main()
 
     std::cout << "Transfer verified\n";
 
+    // Same descriptors again, served from the createXferReq cache
+    extra_params1.hasNotif = false;
+    ret1 = A1.createXferReq(NIXL_WRITE, req_src_descs, req_dst_descs, agent2, req_handle2, &extra_params1);
+    assert (ret1 == NIXL_SUCCESS);
+
+    status = A1.postXferReq(req_handle2);
+    while (status != NIXL_SUCCESS) {
+        status = A1.getXferStatus(req_handle2);
+        assert (status >= 0);
+    }
+
+    ret1 = A1.releaseXferReq(req_handle2);
+    assert (ret1 == NIXL_SUCCESS);
+
+    std::cout << "Cached transfer verified\n";
+
     std::cout << "performing sideXferTest with backends " << ucx1 << " " << ucx2 << "\n";
     ret1 = sideXferTest(&A1, &A2, req_handle, ucx2);
     assert (ret1 == NIXL_SUCCESS);
@@ -0,0 +1,179 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of remote agents invalidated and loaded again under the
+// same name, e.g., after a restart, over the test memory backend. The agent
+// keeps a small id per remote name, which should point to the new metadata
+// after the reload and leave the other remote agents untouched.
+
+std::string agent1("Agent001");
+std::string agent2("Agent002");
+std::string agent3("Agent003");
+
+static const size_t buf_len = 4096;
+
+static void init_agent(nixlAgent &agent, std::vector<char> &buf) {
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret;
+
+    ret = agent.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf.data(), buf.size(), 0));
+    ret = agent.registerMem(reg);
+    assert (ret == NIXL_SUCCESS);
+}
+
+// The initiator loads the metadata of the target
+static void load_md(nixlAgent &initiator, nixlAgent &target) {
+    std::string meta, name;
+    nixl_status_t ret = target.getLocalMD(meta);
+    assert (ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(meta, name);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static nixl_xfer_dlist_t make_dlist(std::vector<char> &buf) {
+    nixl_xfer_dlist_t dlist(DRAM_SEG);
+    dlist.addDesc(nixlBasicDesc((uintptr_t) buf.data(), buf.size(), 0));
+    return dlist;
+}
+
+static nixl_status_t write_buf(nixlAgent &agent, std::vector<char> &src,
+                               std::vector<char> &dst,
+                               const std::string &remote_agent,
+                               nixlXferReqH* &req) {
+    nixl_opt_args_t extra_params;
+    extra_params.hasNotif = true;
+    extra_params.notifMsg = "write";
+    return agent.createXferReq(NIXL_WRITE, make_dlist(src), make_dlist(dst),
+                               remote_agent, req, &extra_params);
+}
+
+// A complete write from agent1, with its notification to the target
+static void check_write(nixlAgent &A1, nixlAgent &target,
+                        const std::string &target_name, std::vector<char> &src,
+                        std::vector<char> &dst, const int seed) {
+    nixlXferReqH* req;
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = (char) (i * 7 + seed);
+
+    nixl_status_t ret = write_buf(A1, src, dst, target_name, req);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req);
+    while (ret == NIXL_IN_PROG)
+        ret = A1.getXferStatus(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (memcmp(src.data(), dst.data(), src.size()) == 0);
+
+    nixl_notifs_t notif_map;
+    ret = target.getNotifs(notif_map);
+    assert (ret == NIXL_SUCCESS);
+    assert (notif_map.size() == 1 && notif_map[agent1].size() == 1);
+    assert (notif_map[agent1].front() == "write");
+
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    nixlAgentConfig cfg(false);
+    std::vector<char> src(buf_len), dst3(buf_len);
+    nixlAgent A1(agent1, cfg);
+    nixlAgent A3(agent3, cfg);
+    init_agent(A1, src);
+    init_agent(A3, dst3);
+    load_md(A1, A3);
+
+    nixlDlistH* local_side;
+    nixl_status_t ret = A1.prepXferDlist(NIXL_INIT_AGENT, make_dlist(src), local_side);
+    assert (ret == NIXL_SUCCESS);
+
+    for (int round = 0; round < 3; ++round) {
+        std::cout << "Reload test, round " << round << "\n";
+
+        // A new incarnation of the target, with other buffers
+        std::vector<char> dst2(buf_len);
+        auto A2 = std::make_unique<nixlAgent>(agent2, cfg);
+        init_agent(*A2, dst2);
+        load_md(A1, *A2);
+
+        check_write(A1, *A2, agent2, src, dst2, round);
+        check_write(A1, A3, agent3, src, dst3, round + 10);
+
+        nixlDlistH* remote_side;
+        ret = A1.prepXferDlist(agent2, make_dlist(dst2), remote_side);
+        assert (ret == NIXL_SUCCESS);
+
+        nixlXferReqH* req;
+        ret = A1.makeXferReq(NIXL_WRITE, local_side, {0}, remote_side, {0}, req);
+        assert (ret == NIXL_SUCCESS);
+        ret = A1.releaseXferReq(req);
+        assert (ret == NIXL_SUCCESS);
+
+        // In progress when its target goes away
+        testMemPolls = 100;
+        nixlXferReqH* pending;
+        ret = write_buf(A1, src, dst2, agent2, pending);
+        assert (ret == NIXL_SUCCESS);
+        assert (A1.postXferReq(pending) == NIXL_IN_PROG);
+        testMemPolls = 1;
+
+        ret = A1.invalidateRemoteMD(agent2);
+        assert (ret == NIXL_SUCCESS);
+
+        // The handle is deleted with the error
+        assert (A1.getXferStatus(pending) == NIXL_ERR_NOT_FOUND);
+
+        ret = A1.makeXferReq(NIXL_WRITE, local_side, {0}, remote_side, {0}, req);
+        assert (ret == NIXL_ERR_NOT_FOUND);
+        ret = A1.releasedDlistH(remote_side);
+        assert (ret == NIXL_SUCCESS);
+
+        ret = write_buf(A1, src, dst2, agent2, req);
+        assert (ret == NIXL_ERR_NOT_FOUND);
+        ret = A1.prepXferDlist(agent2, make_dlist(dst2), remote_side);
+        assert (ret == NIXL_ERR_NOT_FOUND);
+
+        // The other remote agent is not affected
+        check_write(A1, A3, agent3, src, dst3, round + 20);
+
+        A2.reset();
+        testMemNotifs.erase(agent2);
+    }
+
+    ret = A1.releasedDlistH(local_side);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+
+    std::cout << "Test done\n";
+    return 0;
+}
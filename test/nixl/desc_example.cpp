@@ -219,6 +219,28 @@ int main()
     dlist2.print();
     dlist3.print();
 
+    // DescListView functionality, no copies of the viewed list
+    const nixl_meta_dlist_t &dlist6 = dlist5;
+    nixl_meta_dview_t view1 (dlist6);
+    assert (view1.descCount() == dlist6.descCount());
+    assert ((view1.isSorted() == dlist6.isSorted()) && view1.isContiguous());
+    assert (&view1[0] == &dlist6[0]);
+
+    nixl_meta_dview_t view2 (dlist6, 1, 1);
+    assert (view2.descCount() == 1);
+    assert (view2[0] == dlist6[1]);
+
+    int view_indices[] = {1, 0, 1};
+    nixl_meta_dview_t view3 (dlist6, view_indices, 3);
+    assert (!view3.isSorted() && !view3.isContiguous());
+    assert ((view3[0] == dlist6[1]) && (view3[1] == dlist6[0]));
+
+    try {
+        nixl_meta_dview_t view4 (dlist6, 2, 2);
+    } catch (const std::out_of_range& e) {
+        std::cout << "Caught expected error: " << e.what() << std::endl;
+    }
+
     // Populate and unifiedAddr test
     std::cout << "\n\n";
     nixlBlobDesc s1 (10070, 43, 0);
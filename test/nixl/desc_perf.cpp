@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <algorithm>
+
+#include "nixl.h"
+#include "serdes/serdes.h"
+#include "backend/backend_aux.h"
+#include "common/nixl_time.h"
+
+// Per descriptor cost of the descriptor list kernels: populate for each
+// section/query sortedness, and serialize/deserialize of the public lists.
+
+static void report(const std::string &name, nixlTime::ns_t start,
+                   nixlTime::ns_t end, size_t n_descs) {
+    std::cout << name << ": " << (double) (end - start) / n_descs << " ns/desc \n";
+}
+
+void test_populate_perf(const int n_regions, const int n_descs, const int n_iters) {
+    size_t region_len = 1 << 16;
+    size_t desc_len = (region_len * n_regions) / n_descs;
+    nixlTime::ns_t start;
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    std::cout << "populate of " << n_descs << " descs over " << n_regions << " regions \n";
+
+    nixl_meta_dlist_t s_section(DRAM_SEG, true), u_section(DRAM_SEG, false);
+    std::vector<nixlMetaDesc> regions;
+    for (int i = 0; i < n_regions; ++i) {
+        nixlMetaDesc meta(0x100000000 + i * 2 * region_len, region_len, 0);
+        meta.metadataP = (nixlBackendMD*) (uintptr_t) (i + 1);
+        regions.push_back(meta);
+        s_section.addDesc(meta);
+    }
+    std::mt19937 generator(17);
+    std::shuffle(regions.begin(), regions.end(), generator);
+    for (auto &r : regions)
+        u_section.addDesc(r);
+
+    std::vector<nixlBasicDesc> descs;
+    for (int i = 0; i < n_descs; ++i) {
+        size_t offset = i * desc_len;
+        descs.push_back(nixlBasicDesc(0x100000000 +
+                                      (offset / region_len) * 2 * region_len +
+                                      offset % region_len, desc_len, 0));
+    }
+    nixl_xfer_dlist_t s_query(DRAM_SEG, true);
+    for (auto &d : descs)
+        s_query.addDesc(d);
+    std::shuffle(descs.begin(), descs.end(), generator);
+    nixl_xfer_dlist_t u_query(DRAM_SEG, false);
+    for (auto &d : descs)
+        u_query.addDesc(d);
+
+    nixl_meta_dlist_t s_resp(DRAM_SEG, true), u_resp(DRAM_SEG, false);
+
+    start = nixlTime::getNs();
+    for (int i = 0; i < n_iters; i++)
+        ret = s_section.populate(s_query, s_resp);
+    report("sorted section, sorted query", start, nixlTime::getNs(), n_iters * n_descs);
+    assert(ret == NIXL_SUCCESS);
+
+    start = nixlTime::getNs();
+    for (int i = 0; i < n_iters; i++)
+        ret = s_section.populate(u_query, u_resp);
+    report("sorted section, unsorted query", start, nixlTime::getNs(), n_iters * n_descs);
+    assert(ret == NIXL_SUCCESS);
+
+    start = nixlTime::getNs();
+    for (int i = 0; i < n_iters; i++)
+        ret = u_section.populate(u_query, u_resp);
+    report("unsorted section, unsorted query", start, nixlTime::getNs(), n_iters * n_descs);
+    assert(ret == NIXL_SUCCESS);
+}
+
+template <class T>
+void test_serdes_perf(const std::string &name, const nixlDescList<T> &dlist,
+                      const int n_iters) {
+    nixlTime::ns_t start;
+    std::string buf;
+
+    start = nixlTime::getNs();
+    for (int i = 0; i < n_iters; i++) {
+        nixlSerDes ser;
+        nixl_status_t ret = dlist.serialize(&ser);
+        assert(ret == NIXL_SUCCESS);
+        buf = ser.exportStr();
+    }
+    report(name + " serialize", start, nixlTime::getNs(), n_iters * dlist.descCount());
+
+    start = nixlTime::getNs();
+    for (int i = 0; i < n_iters; i++) {
+        nixlSerDes des;
+        des.importStr(buf);
+        nixlDescList<T> out(&des);
+    }
+    report(name + " deserialize", start, nixlTime::getNs(), n_iters * dlist.descCount());
+
+    nixlSerDes des;
+    des.importStr(buf);
+    nixlDescList<T> out(&des);
+    assert(out == dlist);
+}
+
+int main()
+{
+    test_populate_perf(64, 1 << 12, 100);
+    test_populate_perf(1024, 1 << 16, 10);
+
+    nixl_xfer_dlist_t basic(DRAM_SEG);
+    nixl_reg_dlist_t blob(DRAM_SEG);
+    for (int i = 0; i < (1 << 16); ++i) {
+        basic.addDesc(nixlBasicDesc(0x1000 * i, 0x1000, 0));
+        blob.addDesc(nixlBlobDesc(0x1000 * i, 0x1000, 0, "metadata_" + std::to_string(i)));
+    }
+    test_serdes_perf("basic dlist", basic, 10);
+    test_serdes_perf("blob dlist", blob, 10);
+}
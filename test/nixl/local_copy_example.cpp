@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of the loopback DRAM transfers copied by the agent itself,
+// over the test memory backend which should not see any of them. The copies
+// below localCopyAsyncBytes are done within the post, the larger ones by the
+// worker threads if the host has a core to spare for them.
+
+std::string agent1("Agent001");
+
+static const size_t buf_len = 8 << 20;
+
+static nixlXferReqH* make_req(nixlAgent &agent, const nixl_xfer_op_t &op,
+                              std::vector<char> &src, std::vector<char> &dst,
+                              const size_t len, const int count,
+                              const std::string &notif_msg) {
+    // Unaligned and of odd sizes, for the ends of the non-temporal copies
+    nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    for (int i = 0; i < count; ++i) {
+        local.addDesc(nixlBasicDesc((uintptr_t) src.data() + i * (len + 64) + 3,
+                                    len, 0));
+        remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + i * (len + 64) + 5,
+                                     len, 0));
+    }
+
+    nixl_opt_args_t extra_params;
+    if (!notif_msg.empty()) {
+        extra_params.hasNotif = true;
+        extra_params.notifMsg = notif_msg;
+    }
+
+    nixlXferReqH* req;
+    nixl_status_t ret = agent.createXferReq(op, local, remote, agent1, req,
+                                            &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    return req;
+}
+
+// The bytes of each descriptor of make_req were copied from src to dst
+static bool same_bytes(std::vector<char> &src, std::vector<char> &dst,
+                       const size_t len, const int count) {
+    for (int i = 0; i < count; ++i)
+        if (memcmp(src.data() + i * (len + 64) + 3,
+                   dst.data() + i * (len + 64) + 5, len) != 0)
+            return false;
+    return true;
+}
+
+static void fill_buf(std::vector<char> &buf, const int seed) {
+    for (size_t i = 0; i < buf.size(); ++i)
+        buf[i] = (char) (i * 7 + seed);
+}
+
+static nixl_status_t wait_xfer(nixlAgent &agent, nixlXferReqH* req) {
+    nixl_status_t status;
+    while ((status = agent.getXferStatus(req)) == NIXL_IN_PROG);
+    return status;
+}
+
+// Notifications of the local copies come from the agent itself
+static std::vector<nixl_blob_t> get_notifs(nixlAgent &agent) {
+    nixl_notifs_t notif_map;
+    nixl_status_t ret = agent.getNotifs(notif_map);
+    assert (ret == NIXL_SUCCESS);
+    assert (notif_map.size() <= 1);
+    return notif_map[agent1];
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    nixlAgentConfig cfg(false);
+    cfg.localCopy           = true;
+    cfg.localCopyThreads    = 2;
+    cfg.localCopyAsyncBytes = 1 << 20;
+    nixlAgent A1(agent1, cfg);
+
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret = A1.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) src.data(), buf_len, 0));
+    reg.addDesc(nixlBlobDesc((uintptr_t) dst.data(), buf_len, 0));
+    ret = A1.registerMem(reg);
+    assert (ret == NIXL_SUCCESS);
+    fill_buf(src, 1);
+
+    // Workers are only started with a core to spare for them
+    bool threaded = std::thread::hardware_concurrency() > 1;
+
+    std::cout << "Synchronous copy test\n";
+    size_t small_len = 4000;
+    nixlXferReqH* req = make_req(A1, NIXL_WRITE, src, dst, small_len, 4, "small");
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (same_bytes(src, dst, small_len, 4));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A1);
+    assert (notifs.size() == 1 && notifs.front() == "small");
+    assert (testMemNotifs[agent1].empty());
+
+    // Reposted, the copy is done again
+    memset(dst.data(), 0, buf_len);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, small_len, 4));
+    assert (get_notifs(A1).size() == 1);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+
+    std::cout << "Threaded copy test\n";
+    size_t large_len = 3 << 20;
+    memset(dst.data(), 0, buf_len);
+    req = make_req(A1, NIXL_WRITE, src, dst, large_len, 2, "large");
+    ret = A1.postXferReq(req);
+    assert (ret == (threaded ? NIXL_IN_PROG : NIXL_SUCCESS));
+
+    // Notified from the status check that sees all the pieces copied
+    if (threaded)
+        assert (get_notifs(A1).empty());
+    ret = wait_xfer(A1, req);
+    assert (ret == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, large_len, 2));
+    assert (testMemLive == 0);
+
+    notifs = get_notifs(A1);
+    assert (notifs.size() == 1 && notifs.front() == "large");
+    assert (get_notifs(A1).empty());
+
+    // Read back into the source
+    std::vector<char> copy(src);
+    memset(src.data(), 0, buf_len);
+    nixlXferReqH* read_req = make_req(A1, NIXL_READ, src, dst, large_len, 2, "");
+    ret = A1.postXferReq(read_req);
+    assert (ret >= 0);
+    ret = wait_xfer(A1, read_req);
+    assert (ret == NIXL_SUCCESS);
+    assert (same_bytes(copy, dst, large_len, 2));
+    assert (same_bytes(src, dst, large_len, 2));
+    assert (get_notifs(A1).empty());
+    ret = A1.releaseXferReq(read_req);
+    assert (ret == NIXL_SUCCESS);
+
+    // Canceled or released in progress, the workers are done with it
+    ret = A1.postXferReq(req);
+    assert (ret >= 0);
+    ret = A1.cancelXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.getXferStatus(req);
+    assert (ret == NIXL_SUCCESS || ret == NIXL_ERR_NOT_POSTED);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+
+    req = make_req(A1, NIXL_WRITE, src, dst, large_len, 2, "large");
+    ret = A1.postXferReq(req);
+    assert (ret >= 0);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+
+    std::cout << "Test done\n";
+}
@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+#include "common/nixl_time.h"
+
+// Loopback DRAM write bandwidth of an agent to itself, through the backend
+// and with localCopy, for sizes on both sides of localCopyAsyncBytes.
+//
+// Usage: local_copy_perf [backend] [max_mb] [iters]
+
+static void test_local_copy(const std::string &backend, const size_t max_len,
+                            const int iters, const bool local_copy) {
+
+    nixlAgentConfig cfg(false);
+    cfg.localCopy = local_copy;
+    nixlAgent agent("local_copy", cfg);
+
+    nixl_b_params_t params;
+    nixl_mem_list_t mems;
+    nixlBackendH* bknd;
+    nixl_status_t ret;
+
+    ret = agent.getPluginParams(backend, mems, params);
+    assert(ret == NIXL_SUCCESS);
+    ret = agent.createBackend(backend, params, bknd);
+    assert(ret == NIXL_SUCCESS);
+
+    std::vector<char> src(max_len, 1), dst(max_len);
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) src.data(), max_len, 0));
+    reg.addDesc(nixlBlobDesc((uintptr_t) dst.data(), max_len, 0));
+    ret = agent.registerMem(reg);
+    assert(ret == NIXL_SUCCESS);
+
+    std::cout << (local_copy ? "localCopy" : backend) << ":";
+
+    for (size_t len = 4096; len <= max_len; len *= 16) {
+        nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+        local.addDesc(nixlBasicDesc((uintptr_t) src.data(), len, 0));
+        remote.addDesc(nixlBasicDesc((uintptr_t) dst.data(), len, 0));
+
+        nixlXferReqH* req;
+        ret = agent.createXferReq(NIXL_WRITE, local, remote, "local_copy", req);
+        assert(ret == NIXL_SUCCESS);
+
+        nixlTime::us_t start = nixlTime::getUs();
+        for (int i = 0; i < iters; ++i) {
+            ret = agent.postXferReq(req);
+            assert(ret >= 0);
+            while (ret == NIXL_IN_PROG)
+                ret = agent.getXferStatus(req);
+            assert(ret == NIXL_SUCCESS);
+        }
+        nixlTime::us_t elapsed = nixlTime::getUs() - start;
+
+        std::cout << " " << (len >> 10) << "KB " << elapsed / iters << "us "
+                  << (elapsed ? len * iters / elapsed : 0) << " MB/s,";
+
+        agent.releaseXferReq(req);
+    }
+    std::cout << "\n";
+
+    agent.deregisterMem(reg);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string backend = (argc > 1) ? argv[1] : "UCX";
+    size_t max_len      = ((argc > 2) ? std::stoul(argv[2]) : 64) << 20;
+    int iters           = (argc > 3) ? std::stoi(argv[3]) : 100;
+
+    test_local_copy(backend, max_len, iters, false);
+    test_local_copy(backend, max_len, iters, true);
+}
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <vector>
+
+#include "mem_section.h"
+#include "serdes/serdes.h"
+#include "test_mem_backend.h"
+
+// Unit test of the section metadata sent to remote agents. Sections of local
+// only backends are not sent, and the serialized count should match the
+// entries written, or the remote side reads past them.
+
+class nixlLocalOnlyEngine : public nixlTestMemEngine {
+    public:
+        nixlLocalOnlyEngine(const nixlBackendInitParams* init_params) :
+            nixlTestMemEngine(init_params) { }
+
+        bool supportsRemote() const { return false; }
+};
+
+static nixlBackendInitParams make_params(const std::string &agent,
+                                         const nixl_backend_t &type,
+                                         nixl_b_params_t &params,
+                                         const unsigned int &id) {
+    nixlBackendInitParams init_params;
+    init_params.localAgent   = agent;
+    init_params.type         = type;
+    init_params.customParams = &params;
+    init_params.enableProgTh = false;
+    init_params.pthrDelay    = 0;
+    init_params.backendId    = id;
+    return init_params;
+}
+
+int main()
+{
+    nixl_b_params_t params;
+    std::vector<char> buf1(4096), buf2(4096);
+
+    // The local only backend sits between the two remote ones in id order
+    nixlBackendInitParams p0 = make_params("Agent001", "TEST_MEM", params, 0);
+    nixlBackendInitParams p1 = make_params("Agent001", "TEST_LOCAL", params, 1);
+    nixlBackendInitParams p2 = make_params("Agent001", "TEST_MEM2", params, 2);
+    nixlTestMemEngine   local_eng0(&p0);
+    nixlLocalOnlyEngine local_eng1(&p1);
+    nixlTestMemEngine   local_eng2(&p2);
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf1.data(), buf1.size(), 0));
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf2.data(), buf2.size(), 0));
+
+    std::cout << "Serialize test\n";
+    nixl_status_t ret;
+    {
+        nixlLocalSection local;
+        for (nixlBackendEngine* eng : std::vector<nixlBackendEngine*>{
+                 &local_eng0, &local_eng1, &local_eng2}) {
+            nixl_meta_dlist_t remote_self(DRAM_SEG, false);
+            ret = local.addDescList(reg, eng, remote_self);
+            assert (ret == NIXL_SUCCESS);
+            // Loopback metadata, which the agent would keep for itself
+            for (auto & elm : remote_self)
+                eng->unloadMD(elm.metadataP);
+        }
+        assert (local.queryBackends(DRAM_SEG) == 0x7);
+
+        // Followed by another entry, which should be read back intact
+        nixlSerDes ser;
+        ret = local.serialize(&ser);
+        assert (ret == NIXL_SUCCESS);
+        ret = ser.addStr("Next", "next");
+        assert (ret == NIXL_SUCCESS);
+
+        std::cout << "Deserialize test\n";
+        nixlBackendInitParams r0 = make_params("Agent002", "TEST_MEM", params, 0);
+        nixlBackendInitParams r1 = make_params("Agent002", "TEST_MEM2", params, 1);
+        nixlTestMemEngine remote_eng0(&r0);
+        nixlTestMemEngine remote_eng1(&r1);
+        backend_map_t engines = {{"TEST_MEM", &remote_eng0},
+                                 {"TEST_MEM2", &remote_eng1}};
+
+        nixlSerDes des;
+        ret = des.importStr(ser.exportStr());
+        assert (ret == NIXL_SUCCESS);
+
+        nixlRemoteSection remote("Agent001");
+        ret = remote.loadRemoteData(&des, engines);
+        assert (ret == NIXL_SUCCESS);
+        assert (des.getStr("Next") == "next");
+        assert (remote.queryBackends(DRAM_SEG) == 0x3);
+
+        nixl_xfer_dlist_t query(DRAM_SEG);
+        query.addDesc(nixlBasicDesc((uintptr_t) buf2.data() + 8, 64, 0));
+        for (nixlBackendEngine* eng : std::vector<nixlBackendEngine*>{
+                 &remote_eng0, &remote_eng1}) {
+            nixl_meta_dlist_t resp(DRAM_SEG, false);
+            ret = remote.populate(query, eng, resp);
+            assert (ret == NIXL_SUCCESS);
+            assert (resp.descCount() == 1 && resp[0].addr == query[0].addr);
+        }
+    }
+    assert (testMemRegs == 0);
+
+    std::cout << "Test done\n";
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+#include "common/nixl_time.h"
+
+// Writes of many small strided descriptors, sent directly and packed
+// through staging buffers, for a range of descriptor sizes. Each write
+// completes once the target received its notification, and a packed one
+// once the initiator also received the ack of its scatter.
+//
+// Usage: pack_perf [backend] [n_descs] [iters]
+
+static const size_t stride = 8192;
+
+static void test_pack(const std::string &backend, const int n_descs,
+                      const int iters, const bool pack) {
+
+    nixlAgentConfig cfg(false);
+    cfg.packXfers       = pack;
+    cfg.packMaxDescSize = stride;
+    nixlAgent initiator("pack_init", cfg);
+    nixlAgent target("pack_target", cfg);
+
+    nixl_b_params_t params;
+    nixl_mem_list_t mems;
+    nixlBackendH* bknd;
+    nixl_status_t ret;
+
+    ret = initiator.getPluginParams(backend, mems, params);
+    assert(ret == NIXL_SUCCESS);
+    ret = initiator.createBackend(backend, params, bknd);
+    assert(ret == NIXL_SUCCESS);
+    ret = target.createBackend(backend, params, bknd);
+    assert(ret == NIXL_SUCCESS);
+
+    size_t total_len = stride * n_descs;
+    std::vector<char> src(total_len, 1), dst(total_len);
+    std::vector<char> src_staging(total_len), dst_staging(total_len);
+
+    nixl_reg_dlist_t src_reg(DRAM_SEG), dst_reg(DRAM_SEG);
+    src_reg.addDesc(nixlBlobDesc((uintptr_t) src.data(), total_len, 0));
+    src_reg.addDesc(nixlBlobDesc((uintptr_t) src_staging.data(), total_len, 0));
+    dst_reg.addDesc(nixlBlobDesc((uintptr_t) dst.data(), total_len, 0));
+    dst_reg.addDesc(nixlBlobDesc((uintptr_t) dst_staging.data(), total_len, 0));
+    ret = initiator.registerMem(src_reg);
+    assert(ret == NIXL_SUCCESS);
+    ret = target.registerMem(dst_reg);
+    assert(ret == NIXL_SUCCESS);
+
+    // The target acknowledges packed writes to the initiator
+    std::string md, remote_name, init_name;
+    ret = target.getLocalMD(md);
+    assert(ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(md, remote_name);
+    assert(ret == NIXL_SUCCESS);
+    ret = initiator.getLocalMD(md);
+    assert(ret == NIXL_SUCCESS);
+    ret = target.loadRemoteMD(md, init_name);
+    assert(ret == NIXL_SUCCESS);
+
+    nixl_opt_args_t args;
+    args.hasNotif          = true;
+    args.notifMsg          = "pack";
+    args.packLocalStaging  = (uintptr_t) src_staging.data();
+    args.packRemoteStaging = (uintptr_t) dst_staging.data();
+    args.packStagingLen    = total_len;
+
+    std::cout << (pack ? "packed:" : "direct:");
+
+    for (size_t len = 64; len <= stride; len *= 4) {
+        nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+        for (int i = 0; i < n_descs; ++i) {
+            local.addDesc(nixlBasicDesc((uintptr_t) src.data() + i * stride, len, 0));
+            remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + i * stride, len, 0));
+        }
+
+        nixlXferReqH* req;
+        ret = initiator.createXferReq(NIXL_WRITE, local, remote, remote_name,
+                                      req, &args);
+        assert(ret == NIXL_SUCCESS);
+
+        nixlTime::us_t start = nixlTime::getUs();
+        for (int i = 0; i < iters; ++i) {
+            ret = initiator.postXferReq(req);
+            assert(ret >= 0);
+
+            nixl_notifs_t notifs;
+            while ((ret == NIXL_IN_PROG) || notifs.empty()) {
+                nixl_status_t notif_ret = target.getNotifs(notifs);
+                assert(notif_ret == NIXL_SUCCESS);
+                if (ret == NIXL_IN_PROG)
+                    ret = initiator.getXferStatus(req);
+            }
+            assert(ret == NIXL_SUCCESS);
+        }
+        nixlTime::us_t elapsed = nixlTime::getUs() - start;
+
+        std::cout << " " << len << "B " << elapsed / iters << "us,";
+
+        initiator.releaseXferReq(req);
+    }
+    std::cout << "\n";
+
+    initiator.invalidateRemoteMD(remote_name);
+    target.invalidateRemoteMD(init_name);
+    target.deregisterMem(dst_reg);
+    initiator.deregisterMem(src_reg);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string backend = (argc > 1) ? argv[1] : "UCX";
+    int n_descs         = (argc > 2) ? std::stoi(argv[2]) : 4096;
+    int iters           = (argc > 3) ? std::stoi(argv[3]) : 100;
+
+    test_pack(backend, n_descs, iters, false);
+    test_pack(backend, n_descs, iters, true);
+}
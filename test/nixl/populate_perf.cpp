@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <algorithm>
+
+#include <sys/time.h>
+
+#include "nixl.h"
+#include "backend/backend_aux.h"
+#include "common/thread_pool.h"
+
+// Scaling of chunked populate, as done by prepXferDlist when workerThreads
+// is set in nixlAgentConfig, against the serial populate.
+
+void chunked_populate(const nixl_meta_dlist_t &section,
+                      const nixl_xfer_dlist_t &query,
+                      nixl_meta_dlist_t &resp,
+                      nixlThreadPool &pool) {
+    int desc_count = query.descCount();
+    int n_chunks   = pool.size();
+    int chunk_size = (desc_count + n_chunks - 1) / n_chunks;
+
+    pool.parallelFor(n_chunks, [&](size_t i) {
+        int start = i * chunk_size;
+        int end   = std::min(start + chunk_size, desc_count);
+        if (start < end) {
+            nixl_status_t ret = section.populate(query, resp, start, end);
+            assert(ret == NIXL_SUCCESS);
+        }
+    });
+}
+
+void test_populate_perf(const int n_regions, const int n_descs, const bool q_sorted) {
+
+    int n_iters = 10;
+    size_t region_len = 1 << 20;
+    size_t desc_len = (region_len * n_regions) / n_descs;
+
+    nixl_meta_dlist_t section(DRAM_SEG, true);
+    nixl_xfer_dlist_t query(DRAM_SEG, q_sorted);
+    nixlMetaDesc meta;
+    nixlBasicDesc desc;
+
+    struct timeval start_time, end_time, diff_time;
+
+    std::cout << "testing populate of " << n_descs << (q_sorted ? " sorted" : " unsorted")
+              << " descs over " << n_regions << " regions \n";
+
+    // Regions with a gap in between, so no descriptor is covered by 2 of them
+    for (int i = 0; i < n_regions; ++i) {
+        meta.addr      = 0x100000000 + i * 2 * region_len;
+        meta.len       = region_len;
+        meta.devId     = 0;
+        meta.metadataP = (nixlBackendMD*) (uintptr_t) (i + 1);
+        section.addDesc(meta);
+    }
+
+    std::vector<nixlBasicDesc> descs;
+    for (int i = 0; i < n_descs; ++i) {
+        size_t offset = i * desc_len;
+        desc.addr  = 0x100000000 + (offset / region_len) * 2 * region_len +
+                     offset % region_len;
+        desc.len   = desc_len;
+        desc.devId = 0;
+        descs.push_back(desc);
+    }
+    if (!q_sorted) {
+        std::mt19937 generator(17);
+        std::shuffle(descs.begin(), descs.end(), generator);
+    }
+    for (auto &d : descs)
+        query.addDesc(d);
+
+    nixl_meta_dlist_t serial(DRAM_SEG, q_sorted);
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    gettimeofday(&start_time, NULL);
+    for (int i = 0; i < n_iters; i++)
+        ret = section.populate(query, serial);
+    gettimeofday(&end_time, NULL);
+
+    timersub(&end_time, &start_time, &diff_time);
+
+    assert(ret == NIXL_SUCCESS);
+
+    std::cout << "serial populate, total time for " << n_iters << " iters: "
+              << diff_time.tv_sec << "s " << diff_time.tv_usec << "us \n";
+
+    for (int n_threads = 1; n_threads <= 16; n_threads *= 2) {
+        nixlThreadPool pool(n_threads);
+        nixl_meta_dlist_t resp(DRAM_SEG, q_sorted, n_descs);
+
+        gettimeofday(&start_time, NULL);
+        for (int i = 0; i < n_iters; i++)
+            chunked_populate(section, query, resp, pool);
+        gettimeofday(&end_time, NULL);
+
+        timersub(&end_time, &start_time, &diff_time);
+
+        std::cout << n_threads << " threads populate, total time for " << n_iters << " iters: "
+                  << diff_time.tv_sec << "s " << diff_time.tv_usec << "us \n";
+
+        assert(resp == serial);
+    }
+}
+
+int main()
+{
+    // Partial failure leaves the rest of the response untouched
+    nixl_meta_dlist_t section(DRAM_SEG, true);
+    nixl_xfer_dlist_t query(DRAM_SEG, true);
+    nixlMetaDesc meta(0x1000, 0x1000, 0);
+    meta.metadataP = nullptr;
+    section.addDesc(meta);
+    query.addDesc(nixlBasicDesc(0x1000, 0x100, 0));
+    query.addDesc(nixlBasicDesc(0x3000, 0x100, 0));
+
+    nixl_meta_dlist_t resp(DRAM_SEG, true, 2);
+    assert(section.populate(query, resp, 0, 1) == NIXL_SUCCESS);
+    assert(section.populate(query, resp, 1, 2) == NIXL_ERR_UNKNOWN);
+    assert(section.populate(query, resp, 1, 3) == NIXL_ERR_INVALID_PARAM);
+    assert(resp[0].addr == 0x1000);
+
+    test_populate_perf(64, 1 << 16, true);
+    test_populate_perf(64, 1 << 16, false);
+    test_populate_perf(1024, 1 << 20, true);
+    test_populate_perf(1024, 1 << 20, false);
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "nixl.h"
+#include "common/nixl_time.h"
+
+// Tail latency of small high priority reads while low priority bulk writes
+// keep the same backend busy, without priority scheduling and with
+// prioInflightBytes set to a few bulk transfers.
+//
+// Usage: prio_perf [backend] [bulk_mb] [bulk_depth] [n_probes]
+
+static const size_t probe_len = 4096;
+
+static void test_prio_perf(const std::string &backend, const size_t bulk_len,
+                           const int bulk_depth, const int n_probes,
+                           const size_t inflight_bytes) {
+
+    nixlAgentConfig cfg(false);
+    cfg.prioInflightBytes = inflight_bytes;
+    nixlAgent initiator("prio_init", cfg);
+    nixlAgent target("prio_target", cfg);
+
+    nixl_b_params_t params;
+    nixl_mem_list_t mems;
+    nixlBackendH* bknd;
+    nixl_status_t ret;
+
+    ret = initiator.getPluginParams(backend, mems, params);
+    assert(ret == NIXL_SUCCESS);
+    ret = initiator.createBackend(backend, params, bknd);
+    assert(ret == NIXL_SUCCESS);
+    ret = target.createBackend(backend, params, bknd);
+    assert(ret == NIXL_SUCCESS);
+
+    size_t total_len = bulk_len * bulk_depth + probe_len;
+    std::vector<char> src(total_len), dst(total_len);
+
+    nixl_reg_dlist_t src_reg(DRAM_SEG), dst_reg(DRAM_SEG);
+    src_reg.addDesc(nixlBlobDesc((uintptr_t) src.data(), total_len, 0));
+    dst_reg.addDesc(nixlBlobDesc((uintptr_t) dst.data(), total_len, 0));
+    ret = initiator.registerMem(src_reg);
+    assert(ret == NIXL_SUCCESS);
+    ret = target.registerMem(dst_reg);
+    assert(ret == NIXL_SUCCESS);
+
+    std::string md, remote_name;
+    ret = target.getLocalMD(md);
+    assert(ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(md, remote_name);
+    assert(ret == NIXL_SUCCESS);
+
+    nixl_opt_args_t bulk_args, probe_args;
+    bulk_args.priority  = NIXL_PRIO_LOW;
+    probe_args.priority = NIXL_PRIO_HIGH;
+
+    std::vector<nixlXferReqH*> bulk(bulk_depth);
+    for (int i = 0; i < bulk_depth; ++i) {
+        nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+        local.addDesc(nixlBasicDesc((uintptr_t) src.data() + i * bulk_len, bulk_len, 0));
+        remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + i * bulk_len, bulk_len, 0));
+        ret = initiator.createXferReq(NIXL_WRITE, local, remote, remote_name,
+                                      bulk[i], &bulk_args);
+        assert(ret == NIXL_SUCCESS);
+    }
+
+    nixlXferReqH* probe;
+    nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    local.addDesc(nixlBasicDesc((uintptr_t) src.data() + bulk_len * bulk_depth, probe_len, 0));
+    remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + bulk_len * bulk_depth, probe_len, 0));
+    ret = initiator.createXferReq(NIXL_READ, local, remote, remote_name,
+                                  probe, &probe_args);
+    assert(ret == NIXL_SUCCESS);
+
+    for (auto &req : bulk) {
+        ret = initiator.postXferReq(req);
+        assert(ret >= 0);
+    }
+
+    std::vector<nixlTime::us_t> latencies;
+    nixlTime::us_t start = nixlTime::getUs();
+    nixlTime::us_t probe_start = 0;
+    bool probe_active = false;
+    size_t bulk_bytes = 0;
+
+    while ((int) latencies.size() < n_probes) {
+        for (auto &req : bulk) {
+            ret = initiator.getXferStatus(req);
+            if (ret == NIXL_IN_PROG)
+                continue;
+            assert(ret == NIXL_SUCCESS);
+            bulk_bytes += bulk_len;
+            ret = initiator.postXferReq(req);
+            assert(ret >= 0);
+        }
+
+        if (!probe_active) {
+            probe_start = nixlTime::getUs();
+            ret = initiator.postXferReq(probe);
+            assert(ret >= 0);
+            probe_active = true;
+        }
+
+        ret = initiator.getXferStatus(probe);
+        assert(ret >= 0);
+        if (ret == NIXL_SUCCESS) {
+            latencies.push_back(nixlTime::getUs() - probe_start);
+            probe_active = false;
+        }
+    }
+    nixlTime::us_t elapsed = nixlTime::getUs() - start;
+
+    for (auto &req : bulk)
+        while (initiator.getXferStatus(req) == NIXL_IN_PROG);
+    for (auto &req : bulk)
+        initiator.releaseXferReq(req);
+    initiator.releaseXferReq(probe);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto pct = [&](double p) {
+        return latencies[std::min(latencies.size() - 1,
+                                  (size_t) (p * latencies.size()))];
+    };
+
+    if (inflight_bytes)
+        std::cout << "prioInflightBytes " << (inflight_bytes >> 20) << "MB";
+    else
+        std::cout << "no priority scheduling";
+    std::cout << ", " << bulk_depth << " bulk writes of " << (bulk_len >> 20)
+              << "MB: probe p50 " << pct(0.5) << "us p99 " << pct(0.99)
+              << "us p99.9 " << pct(0.999) << "us max " << latencies.back()
+              << "us, bulk " << (elapsed ? bulk_bytes / elapsed : 0) << " MB/s\n";
+
+    initiator.invalidateRemoteMD(remote_name);
+    target.deregisterMem(dst_reg);
+    initiator.deregisterMem(src_reg);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string backend = (argc > 1) ? argv[1] : "UCX";
+    size_t bulk_len     = ((argc > 2) ? std::stoul(argv[2]) : 8) << 20;
+    int bulk_depth      = (argc > 3) ? std::stoi(argv[3]) : 8;
+    int n_probes        = (argc > 4) ? std::stoi(argv[4]) : 2000;
+
+    test_prio_perf(backend, bulk_len, bulk_depth, n_probes, 0);
+    test_prio_perf(backend, bulk_len, bulk_depth, n_probes, bulk_len);
+    test_prio_perf(backend, bulk_len, bulk_depth, n_probes, 2 * bulk_len);
+}
@@ -0,0 +1,194 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of registerMemAsync, with agents of the same process over
+// the test memory backend. The background registration is held back with
+// testMemRegHold, to check the status before and after it, and the memory is
+// then used in transfers in both directions.
+
+std::string agent1("Agent001");
+std::string agent2("Agent002");
+
+static const size_t buf_len   = 1 << 20;
+static const int    buf_parts = 4;
+
+static void init_agent(nixlAgent &agent) {
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret = agent.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static nixl_reg_dlist_t make_reg(std::vector<char> &buf, const int parts) {
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    size_t len = buf.size() / parts;
+    for (int i = 0; i < parts; ++i)
+        reg.addDesc(nixlBlobDesc((uintptr_t) buf.data() + i * len, len, 0));
+    return reg;
+}
+
+// The initiator loads the metadata of the target
+static void load_md(nixlAgent &initiator, nixlAgent &target) {
+    std::string meta, name;
+    nixl_status_t ret = target.getLocalMD(meta);
+    assert (ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(meta, name);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static void fill_buf(std::vector<char> &buf, const int seed) {
+    for (size_t i = 0; i < buf.size(); ++i)
+        buf[i] = (char) (i * 7 + seed);
+}
+
+// Whole buffer write from the initiator to the target, in as many
+// descriptors as registered parts
+static void write_all(nixlAgent &initiator, std::vector<char> &src,
+                      std::vector<char> &dst, const std::string &target) {
+    nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    size_t len = src.size() / buf_parts;
+    for (int i = 0; i < buf_parts; ++i) {
+        local.addDesc(nixlBasicDesc((uintptr_t) src.data() + i * len, len, 0));
+        remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + i * len, len, 0));
+    }
+
+    nixlXferReqH* req;
+    nixl_status_t ret = initiator.createXferReq(NIXL_WRITE, local, remote,
+                                                target, req);
+    assert (ret == NIXL_SUCCESS);
+
+    ret = initiator.postXferReq(req);
+    while (ret == NIXL_IN_PROG)
+        ret = initiator.getXferStatus(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (memcmp(src.data(), dst.data(), src.size()) == 0);
+
+    ret = initiator.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static nixl_status_t wait_reg(nixlAgent &agent, nixlRegReqH* req) {
+    nixl_status_t status;
+    while ((status = agent.getRegStatus(req)) == NIXL_IN_PROG);
+    return status;
+}
+
+static void test_parallel() {
+    std::cout << "Background registration test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.workerThreads = 4;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+    init_agent(A1);
+    init_agent(A2);
+
+    std::vector<char> buf1(buf_len), buf2(buf_len);
+    nixl_reg_dlist_t reg1 = make_reg(buf1, buf_parts);
+    nixl_reg_dlist_t reg2 = make_reg(buf2, 1);
+    assert (A2.registerMem(reg2) == NIXL_SUCCESS);
+    assert (testMemRegs == 1);
+
+    // In progress till the backend registrations are let through
+    testMemParallelReg = true;
+    testMemRegHold     = true;
+    nixlRegReqH* req;
+    nixl_status_t ret = A1.registerMemAsync(reg1, req);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getRegStatus(req) == NIXL_IN_PROG);
+    assert (A1.getRegStatus(req) == NIXL_IN_PROG);
+    assert (testMemRegs == 1);
+
+    testMemRegHold = false;
+    ret = wait_reg(A1, req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemRegs == 1 + buf_parts);
+    assert (A1.getRegStatus(req) == NIXL_SUCCESS);
+    assert (A1.releaseRegReq(req) == NIXL_SUCCESS);
+    assert (testMemRegs == 1 + buf_parts);
+
+    // Usable from both sides, including its metadata for the peer
+    load_md(A1, A2);
+    load_md(A2, A1);
+    fill_buf(buf1, 1);
+    write_all(A1, buf1, buf2, agent2);
+    fill_buf(buf2, 2);
+    write_all(A2, buf2, buf1, agent1);
+
+    // Released before being collected, the registration is undone
+    std::vector<char> buf3(buf_len);
+    ret = A1.registerMemAsync(make_reg(buf3, buf_parts), req);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.releaseRegReq(req) == NIXL_SUCCESS);
+    assert (testMemRegs == 1 + buf_parts);
+    testMemParallelReg = false;
+
+    assert (A1.deregisterMem(reg1) == NIXL_SUCCESS);
+    assert (A2.deregisterMem(reg2) == NIXL_SUCCESS);
+    assert (testMemRegs == 0);
+}
+
+static void test_serial() {
+    std::cout << "Registration on status check test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+    init_agent(A1);
+    init_agent(A2);
+
+    std::vector<char> buf1(buf_len), buf2(buf_len);
+    nixl_reg_dlist_t reg1 = make_reg(buf1, buf_parts);
+    nixl_reg_dlist_t reg2 = make_reg(buf2, 1);
+    assert (A2.registerMem(reg2) == NIXL_SUCCESS);
+
+    // Without parallel registration, only the pre-fault is in the background
+    // and the backend registers in the status check that finds it done
+    nixlRegReqH* req;
+    nixl_status_t ret = A1.registerMemAsync(reg1, req);
+    assert (ret == NIXL_SUCCESS);
+    while ((ret = A1.getRegStatus(req)) == NIXL_IN_PROG)
+        assert (testMemRegs == 1);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemRegs == 1 + buf_parts);
+    assert (A1.releaseRegReq(req) == NIXL_SUCCESS);
+
+    load_md(A1, A2);
+    fill_buf(buf1, 3);
+    write_all(A1, buf1, buf2, agent2);
+
+    assert (A1.deregisterMem(reg1) == NIXL_SUCCESS);
+    assert (A2.deregisterMem(reg2) == NIXL_SUCCESS);
+    assert (testMemRegs == 0);
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    test_parallel();
+    test_serial();
+
+    std::cout << "Test done\n";
+    return 0;
+}
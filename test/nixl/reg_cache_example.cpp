@@ -0,0 +1,102 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of the registration cache over the test memory backend,
+// counting the backend registrations behind the agent ones.
+
+std::string agent1("Agent001");
+
+static const size_t buf_len = 64 << 10;
+
+static nixl_reg_dlist_t reg_list(std::vector<char> &buf, const size_t offset,
+                                 const size_t len) {
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf.data() + offset, len, 0));
+    return reg;
+}
+
+static nixl_xfer_dlist_t xfer_list(std::vector<char> &buf, const size_t offset,
+                                   const size_t len) {
+    nixl_xfer_dlist_t descs(DRAM_SEG);
+    descs.addDesc(nixlBasicDesc((uintptr_t) buf.data() + offset, len, 0));
+    return descs;
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    nixlAgentConfig cfg(false);
+    cfg.regCacheSize = 1 << 20;
+    nixlAgent A1(agent1, cfg);
+
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret = A1.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+
+    std::vector<char> buf(buf_len);
+    nixl_reg_dlist_t small = reg_list(buf, 16 << 10, 4 << 10);
+    nixl_reg_dlist_t large = reg_list(buf, 0, buf_len);
+    nixl_reg_dlist_t inner = reg_list(buf, 32 << 10, 4 << 10);
+
+    std::cout << "Lazy deregistration test\n";
+    assert (A1.registerMem(small) == NIXL_SUCCESS);
+    assert (A1.deregisterMem(small) == NIXL_SUCCESS);
+    assert (testMemRegs == 1);
+    assert (A1.registerMem(small) == NIXL_SUCCESS);
+    assert (testMemRegs == 1);
+    assert (A1.deregisterMem(small) == NIXL_SUCCESS);
+
+    // Not covered by the small region, so registered on its own
+    assert (A1.registerMem(large) == NIXL_SUCCESS);
+    assert (A1.deregisterMem(large) == NIXL_SUCCESS);
+    assert (testMemRegs == 2);
+
+    std::cout << "Enclosing region test\n";
+    // Within the large region, past the small one which sorts in between
+    assert (A1.registerMem(inner) == NIXL_SUCCESS);
+    assert (testMemRegs == 2);
+
+    std::cout << "Released memory test\n";
+    ret = A1.releasedMem(xfer_list(buf, 32 << 10, 4 << 10));
+    assert (ret == NIXL_ERR_NOT_ALLOWED);
+    assert (testMemRegs == 2);
+
+    assert (A1.deregisterMem(inner) == NIXL_SUCCESS);
+    ret = A1.releasedMem(xfer_list(buf, 32 << 10, 4 << 10));
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemRegs == 1);
+
+    ret = A1.releasedMem(xfer_list(buf, 0, buf_len));
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemRegs == 0);
+
+    // Registered again after the release
+    assert (A1.registerMem(inner) == NIXL_SUCCESS);
+    assert (testMemRegs == 1);
+    assert (A1.deregisterMem(inner) == NIXL_SUCCESS);
+
+    std::cout << "Test done\n";
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/time.h>
+
+#include "nixl.h"
+
+// Startup registration time of a host memory pool split into regions, with
+// registerMem against registerMemAsync using workerThreads threads. Memory is
+// freshly mapped for each run, so page faults are part of the cost as they
+// are at startup.
+//
+// Usage: reg_perf [backend] [n_regions] [region_mb]
+
+static std::vector<void*> map_regions(const int n_regions, const size_t region_len) {
+    std::vector<void*> regions;
+    for (int i = 0; i < n_regions; ++i) {
+        void* addr = mmap(nullptr, region_len, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        assert(addr != MAP_FAILED);
+        regions.push_back(addr);
+    }
+    return regions;
+}
+
+static void test_reg_perf(const std::string &backend, const int n_regions,
+                          const size_t region_len, const size_t n_threads) {
+
+    nixlAgentConfig cfg(false);
+    cfg.workerThreads = n_threads;
+    nixlAgent agent("reg_perf", cfg);
+
+    nixl_b_params_t params;
+    nixl_mem_list_t mems;
+    nixlBackendH* bknd;
+    nixl_status_t ret;
+
+    ret = agent.getPluginParams(backend, mems, params);
+    assert(ret == NIXL_SUCCESS);
+    ret = agent.createBackend(backend, params, bknd);
+    assert(ret == NIXL_SUCCESS);
+
+    std::vector<void*> regions = map_regions(n_regions, region_len);
+    nixl_reg_dlist_t descs(DRAM_SEG);
+    for (auto &addr : regions)
+        descs.addDesc(nixlBlobDesc((uintptr_t) addr, region_len, 0));
+
+    struct timeval start_time, end_time, diff_time;
+
+    gettimeofday(&start_time, NULL);
+    if (n_threads == 0) {
+        ret = agent.registerMem(descs);
+    } else {
+        nixlRegReqH* req;
+        ret = agent.registerMemAsync(descs, req);
+        assert(ret == NIXL_SUCCESS);
+        while ((ret = agent.getRegStatus(req)) == NIXL_IN_PROG);
+        agent.releaseRegReq(req);
+    }
+    gettimeofday(&end_time, NULL);
+    assert(ret == NIXL_SUCCESS);
+
+    timersub(&end_time, &start_time, &diff_time);
+
+    if (n_threads == 0)
+        std::cout << "registerMem";
+    else
+        std::cout << "registerMemAsync with " << n_threads << " threads";
+    std::cout << ", " << n_regions << " regions of " << (region_len >> 20)
+              << "MB: " << diff_time.tv_sec << "s " << diff_time.tv_usec << "us \n";
+
+    ret = agent.deregisterMem(descs);
+    assert(ret == NIXL_SUCCESS);
+    for (auto &addr : regions)
+        munmap(addr, region_len);
+}
+
+int main(int argc, char *argv[])
+{
+    std::string backend = (argc > 1) ? argv[1] : "UCX";
+    int n_regions       = (argc > 2) ? std::stoi(argv[2]) : 64;
+    size_t region_len   = ((argc > 3) ? std::stoul(argv[3]) : 64) << 20;
+
+    test_reg_perf(backend, n_regions, region_len, 0);
+    for (size_t n_threads = 1; n_threads <= 16; n_threads *= 2)
+        test_reg_perf(backend, n_regions, region_len, n_threads);
+}
@@ -0,0 +1,240 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __TEST_MEM_BACKEND_H
+#define __TEST_MEM_BACKEND_H
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "backend/backend_plugin.h"
+#include "plugin_manager.h"
+
+// In-process DRAM backend for the functional tests of the agent, so they
+// can check the agent side of transfers without network or devices. Data
+// is copied when a transfer is posted, and the transfer completes after
+// testMemPolls checkXfer calls per descriptor, so posts of more descriptors
+// take longer, and its notification is delivered then. The agents of the
+// process share the notification queues, by receiving agent.
+//
+// It is registered as two static plugins, TEST_MEM and TEST_MEM2, for the
+// tests needing several backends. With testMemParallelReg, registration is
+// reported as thread safe, and registerMem waits while testMemRegHold is set,
+// to keep the background work of registerMemAsync in progress.
+
+inline int                                 testMemPolls = 1;
+inline int                                 testMemLive  = 0; // Backend handles
+inline std::atomic<int>                    testMemRegs{0};   // Registrations
+inline bool                                testMemParallelReg = false;
+inline std::atomic<bool>                   testMemRegHold{false};
+inline std::mutex                          testMemLock;
+inline std::map<std::string, notif_list_t> testMemNotifs;
+
+class nixlTestMemMD : public nixlBackendMD {
+    public:
+        nixlTestMemMD() : nixlBackendMD(true) { }
+};
+
+class nixlTestMemReqH : public nixlBackendReqH {
+    public:
+        int         polls    = 0;
+        bool        hasNotif = false;
+        std::string remoteAgent;
+        nixl_blob_t notifMsg;
+};
+
+class nixlTestMemEngine : public nixlBackendEngine {
+    private:
+        void deliver(const std::string &remote_agent, const nixl_blob_t &msg) {
+            std::lock_guard<std::mutex> lk(testMemLock);
+            testMemNotifs[remote_agent].push_back({localAgent, msg});
+        }
+
+    public:
+        nixlTestMemEngine(const nixlBackendInitParams* init_params) :
+            nixlBackendEngine(init_params) { }
+
+        bool supportsRemote() const { return true; }
+        bool supportsLocal() const { return true; }
+        bool supportsNotif() const { return true; }
+        bool supportsProgTh() const { return false; }
+        bool supportsParallelReg() const { return testMemParallelReg; }
+
+        nixl_mem_list_t getSupportedMems() const { return {DRAM_SEG}; }
+
+        nixl_status_t registerMem(const nixlBlobDesc &mem,
+                                  const nixl_mem_t &nixl_mem,
+                                  nixlBackendMD* &out) {
+            while (testMemRegHold.load())
+                std::this_thread::yield();
+            out = new nixlTestMemMD();
+            testMemRegs++;
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t deregisterMem(nixlBackendMD* meta) {
+            delete meta;
+            testMemRegs--;
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t connect(const std::string &remote_agent) { return NIXL_SUCCESS; }
+        nixl_status_t disconnect(const std::string &remote_agent) { return NIXL_SUCCESS; }
+
+        nixl_status_t unloadMD(nixlBackendMD* input) {
+            delete input;
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t getPublicData(const nixlBackendMD* meta, std::string &str) const {
+            str = "test_mem";
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t getConnInfo(std::string &str) const {
+            str = localAgent;
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t loadRemoteConnInfo(const std::string &remote_agent,
+                                         const std::string &remote_conn_info) {
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t loadRemoteMD(const nixlBlobDesc &input,
+                                   const nixl_mem_t &nixl_mem,
+                                   const std::string &remote_agent,
+                                   nixlBackendMD* &output) {
+            output = new nixlTestMemMD();
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t loadLocalMD(nixlBackendMD* input, nixlBackendMD* &output) {
+            output = new nixlTestMemMD();
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t prepXfer(const nixl_xfer_op_t &operation,
+                               const nixl_meta_dview_t &local,
+                               const nixl_meta_dview_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH* &handle,
+                               const nixl_opt_b_args_t* opt_args=nullptr) {
+            if (local.descCount() != remote.descCount())
+                return NIXL_ERR_INVALID_PARAM;
+            handle = nullptr;
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t postXfer(const nixl_xfer_op_t &operation,
+                               const nixl_meta_dview_t &local,
+                               const nixl_meta_dview_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH* &handle,
+                               const nixl_opt_b_args_t* opt_args=nullptr) {
+            for (int i = 0; i < local.descCount(); ++i) {
+                void* local_addr  = (void*) local[i].addr;
+                void* remote_addr = (void*) remote[i].addr;
+                if (operation == NIXL_WRITE)
+                    memcpy(remote_addr, local_addr, local[i].len);
+                else
+                    memcpy(local_addr, remote_addr, local[i].len);
+            }
+
+            nixlTestMemReqH* req = new nixlTestMemReqH();
+            req->polls       = testMemPolls * local.descCount();
+            req->remoteAgent = remote_agent;
+            if (opt_args && opt_args->hasNotif) {
+                req->hasNotif = true;
+                req->notifMsg = opt_args->notifMsg;
+            }
+            handle = req;
+            testMemLive++;
+            return checkXfer(handle);
+        }
+
+        nixl_status_t checkXfer(nixlBackendReqH* handle) {
+            nixlTestMemReqH* req = (nixlTestMemReqH*) handle;
+            if (req->polls-- > 0)
+                return NIXL_IN_PROG;
+            if (req->hasNotif) {
+                deliver(req->remoteAgent, req->notifMsg);
+                req->hasNotif = false;
+            }
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t releaseReqH(nixlBackendReqH* handle) {
+            if (handle) {
+                delete (nixlTestMemReqH*) handle;
+                testMemLive--;
+            }
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t getNotifs(notif_list_t &notif_list) {
+            std::lock_guard<std::mutex> lk(testMemLock);
+            notif_list_t &queue = testMemNotifs[localAgent];
+            notif_list.insert(notif_list.end(), queue.begin(), queue.end());
+            queue.clear();
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t genNotif(const std::string &remote_agent, const std::string &msg) {
+            deliver(remote_agent, msg);
+            return NIXL_SUCCESS;
+        }
+};
+
+static inline nixlBackendEngine* testMemCreate(const nixlBackendInitParams* init_params) {
+    return new nixlTestMemEngine(init_params);
+}
+
+static inline void testMemDestroy(nixlBackendEngine* engine) {
+    delete engine;
+}
+
+static inline const char* testMemName() { return "TEST_MEM"; }
+static inline const char* testMemName2() { return "TEST_MEM2"; }
+static inline const char* testMemVersion() { return "0.1"; }
+static inline nixl_b_params_t testMemOptions() { return nixl_b_params_t(); }
+static inline nixl_mem_list_t testMemMems() { return {DRAM_SEG}; }
+
+static inline nixlBackendPlugin* testMemPlugin() {
+    static nixlBackendPlugin plugin = {NIXL_PLUGIN_API_VERSION, testMemCreate,
+                                       testMemDestroy, testMemName, testMemVersion,
+                                       testMemOptions, testMemMems};
+    return &plugin;
+}
+
+static inline nixlBackendPlugin* testMemPlugin2() {
+    static nixlBackendPlugin plugin = {NIXL_PLUGIN_API_VERSION, testMemCreate,
+                                       testMemDestroy, testMemName2, testMemVersion,
+                                       testMemOptions, testMemMems};
+    return &plugin;
+}
+
+static inline void registerTestMemBackends() {
+    nixlPluginManager &plugin_manager = nixlPluginManager::getInstance();
+    plugin_manager.registerStaticPlugin("TEST_MEM", testMemPlugin);
+    plugin_manager.registerStaticPlugin("TEST_MEM2", testMemPlugin2);
+}
+
+#endif
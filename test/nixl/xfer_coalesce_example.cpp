@@ -0,0 +1,400 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of the coalescing of small posts to the same peer, with
+// agents of the same process over the test memory backend. Each case checks
+// when the merged transfer is given to the backend, the status of each of its
+// requests and the order of their notifications.
+
+std::string agent1("Agent001");
+std::string agent2("Agent002");
+
+static const size_t buf_len  = 1 << 16;
+static const size_t xfer_len = 4096;
+
+static void init_agent(nixlAgent &agent, std::vector<char> &buf) {
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret;
+
+    ret = agent.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf.data(), buf.size(), 0));
+    ret = agent.registerMem(reg);
+    assert (ret == NIXL_SUCCESS);
+}
+
+// The initiator loads the metadata of the target
+static void load_md(nixlAgent &initiator, nixlAgent &target) {
+    std::string meta, name;
+    nixl_status_t ret = target.getLocalMD(meta);
+    assert (ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(meta, name);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static void fill_buf(std::vector<char> &buf, const int seed) {
+    for (size_t i = 0; i < buf.size(); ++i)
+        buf[i] = (char) (i * 7 + seed);
+}
+
+// Write of the index-th xfer_len bytes of src to the same place in dst
+static nixlXferReqH* make_req(nixlAgent &agent, std::vector<char> &src,
+                              std::vector<char> &dst, const size_t index,
+                              const size_t len = xfer_len) {
+    nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    local.addDesc(nixlBasicDesc((uintptr_t) src.data() + index * xfer_len, len, 0));
+    remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + index * xfer_len, len, 0));
+
+    nixl_opt_args_t extra_params;
+    extra_params.hasNotif = true;
+    extra_params.notifMsg = "xfer" + std::to_string(index);
+
+    nixlXferReqH* req;
+    nixl_status_t ret = agent.createXferReq(NIXL_WRITE, local, remote, agent2,
+                                            req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    return req;
+}
+
+static bool same_bytes(std::vector<char> &src, std::vector<char> &dst,
+                       const size_t index) {
+    return memcmp(src.data() + index * xfer_len, dst.data() + index * xfer_len,
+                  xfer_len) == 0;
+}
+
+static nixl_status_t wait_xfer(nixlAgent &agent, nixlXferReqH* req) {
+    nixl_status_t status;
+    while ((status = agent.getXferStatus(req)) == NIXL_IN_PROG);
+    return status;
+}
+
+static std::vector<nixl_blob_t> get_notifs(nixlAgent &agent) {
+    nixl_notifs_t notif_map;
+    nixl_status_t ret = agent.getNotifs(notif_map);
+    assert (ret == NIXL_SUCCESS);
+    return notif_map[agent1];
+}
+
+static void test_merge() {
+    std::cout << "Merged posts test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.coalesceMaxReqs  = 3;
+    cfg.coalesceMaxBytes = 2 * xfer_len;
+    cfg.coalesceWindowUs = 10000000;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 1);
+
+    std::vector<nixlXferReqH*> reqs;
+    for (size_t i = 0; i < 3; ++i)
+        reqs.push_back(make_req(A1, src, dst, i));
+
+    // Gathered without going to the backend till the batch is full
+    testMemPolls = 2;
+    assert (A1.postXferReq(reqs[0]) == NIXL_IN_PROG);
+    assert (A1.postXferReq(reqs[1]) == NIXL_IN_PROG);
+    assert (A1.getXferStatus(reqs[0]) == NIXL_IN_PROG);
+    assert (testMemLive == 0);
+    assert (!same_bytes(src, dst, 0));
+
+    assert (A1.postXferReq(reqs[2]) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+    assert (get_notifs(A2).empty());
+
+    // Completed as a whole, seen from any of the requests
+    nixl_status_t ret = wait_xfer(A1, reqs[1]);
+    assert (ret == NIXL_SUCCESS);
+    for (size_t i = 0; i < 3; ++i) {
+        assert (A1.getXferStatus(reqs[i]) == NIXL_SUCCESS);
+        assert (same_bytes(src, dst, i));
+    }
+
+    // One notification per request, in order of post
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 3);
+    assert (notifs[0] == "xfer0" && notifs[1] == "xfer1" && notifs[2] == "xfer2");
+
+    // Reposted in another order, they are notified in the new order
+    memset(dst.data(), 0, buf_len);
+    assert (A1.postXferReq(reqs[2]) == NIXL_IN_PROG);
+    assert (A1.postXferReq(reqs[0]) == NIXL_IN_PROG);
+    assert (A1.postXferReq(reqs[1]) == NIXL_IN_PROG);
+    ret = wait_xfer(A1, reqs[0]);
+    assert (ret == NIXL_SUCCESS);
+    notifs = get_notifs(A2);
+    assert (notifs.size() == 3);
+    assert (notifs[0] == "xfer2" && notifs[1] == "xfer0" && notifs[2] == "xfer1");
+
+    for (size_t i = 0; i < 3; ++i) {
+        assert (same_bytes(src, dst, i));
+        ret = A1.releaseXferReq(reqs[i]);
+        assert (ret == NIXL_SUCCESS);
+    }
+    assert (testMemLive == 0);
+
+    // A post over coalesceMaxBytes goes to the backend by itself
+    nixlXferReqH* req = make_req(A1, src, dst, 4, 4 * xfer_len);
+    assert (A1.postXferReq(req) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+    ret = wait_xfer(A1, req);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (get_notifs(A2).size() == 1);
+    testMemPolls = 1;
+}
+
+static void test_window() {
+    std::cout << "Coalescing window test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.coalesceMaxReqs  = 8;
+    cfg.coalesceWindowUs = 100000;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 2);
+
+    nixlXferReqH* req0 = make_req(A1, src, dst, 0);
+    nixlXferReqH* req1 = make_req(A1, src, dst, 1);
+    assert (A1.postXferReq(req0) == NIXL_IN_PROG);
+    assert (A1.postXferReq(req1) == NIXL_IN_PROG);
+    assert (testMemLive == 0);
+
+    // Without further posts, the status checks post the batch once the
+    // window is over
+    nixl_status_t ret = wait_xfer(A1, req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 1);
+    assert (A1.getXferStatus(req0) == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 0) && same_bytes(src, dst, 1));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 2);
+    assert (notifs[0] == "xfer0" && notifs[1] == "xfer1");
+
+    // Polling only for notifications also posts the batch
+    assert (A1.postXferReq(req0) == NIXL_IN_PROG);
+    assert (A1.postXferReq(req1) == NIXL_IN_PROG);
+    assert (testMemLive == 0);
+    while (testMemLive == 0)
+        assert (get_notifs(A1).empty());
+    ret = wait_xfer(A1, req0);
+    assert (ret == NIXL_SUCCESS);
+    assert (get_notifs(A2).size() == 2);
+
+    ret = A1.releaseXferReq(req0);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.releaseXferReq(req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+}
+
+static void test_release() {
+    std::cout << "Release of coalesced posts test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.coalesceMaxReqs  = 3;
+    cfg.coalesceWindowUs = 10000000;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 3);
+
+    std::vector<nixlXferReqH*> reqs;
+    for (size_t i = 0; i < 4; ++i)
+        reqs.push_back(make_req(A1, src, dst, i));
+
+    // Released from the open batch, it is left out of the merged transfer
+    testMemPolls = 1000;
+    assert (A1.postXferReq(reqs[0]) == NIXL_IN_PROG);
+    assert (A1.postXferReq(reqs[1]) == NIXL_IN_PROG);
+    nixl_status_t ret = A1.releaseXferReq(reqs[0]);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.postXferReq(reqs[2]) == NIXL_IN_PROG);
+    assert (testMemLive == 0);
+    assert (A1.postXferReq(reqs[3]) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+
+    // The merged transfer can't be aborted for one of its requests
+    ret = A1.releaseXferReq(reqs[1]);
+    assert (ret == NIXL_ERR_REPOST_ACTIVE);
+    assert (A1.getXferStatus(reqs[1]) == NIXL_IN_PROG);
+
+    ret = wait_xfer(A1, reqs[2]);
+    assert (ret == NIXL_SUCCESS);
+    assert (!same_bytes(src, dst, 0));
+    for (size_t i = 1; i < 4; ++i)
+        assert (same_bytes(src, dst, i));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 3);
+    assert (notifs[0] == "xfer1" && notifs[1] == "xfer2" && notifs[2] == "xfer3");
+
+    // Completed, the requests are released one by one
+    for (size_t i = 1; i < 4; ++i) {
+        assert (testMemLive == 1);
+        ret = A1.releaseXferReq(reqs[i]);
+        assert (ret == NIXL_SUCCESS);
+    }
+    assert (testMemLive == 0);
+    testMemPolls = 1;
+}
+
+static void test_release_done() {
+    std::cout << "Release of a completed coalesced post test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.coalesceMaxReqs  = 2;
+    cfg.coalesceWindowUs = 10000000;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 5);
+
+    nixlXferReqH* req0 = make_req(A1, src, dst, 0);
+    nixlXferReqH* req1 = make_req(A1, src, dst, 1);
+
+    testMemPolls = 1000;
+    assert (A1.postXferReq(req0) == NIXL_IN_PROG);
+    assert (A1.postXferReq(req1) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+
+    // Not released while the merged transfer is in progress for the other
+    nixl_status_t ret = A1.releaseXferReq(req0);
+    assert (ret == NIXL_ERR_REPOST_ACTIVE);
+
+    // Once it completed, released while the other was not checked yet
+    ret = wait_xfer(A1, req0);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.releaseXferReq(req0);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 1);
+
+    // The other still sees the completion, without notifying again
+    assert (A1.getXferStatus(req1) == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 0) && same_bytes(src, dst, 1));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 2);
+    assert (notifs[0] == "xfer0" && notifs[1] == "xfer1");
+
+    ret = A1.releaseXferReq(req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    testMemPolls = 1;
+}
+
+static void test_cancel() {
+    std::cout << "Cancel of coalesced posts test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.coalesceMaxReqs  = 2;
+    cfg.coalesceWindowUs = 10000000;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 4);
+
+    nixlXferReqH* req0 = make_req(A1, src, dst, 0);
+    nixlXferReqH* req1 = make_req(A1, src, dst, 1);
+
+    testMemPolls = 1000;
+    assert (A1.postXferReq(req0) == NIXL_IN_PROG);
+    assert (A1.postXferReq(req1) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+
+    // Canceled, it leaves the merged transfer, which goes on for the other
+    nixl_status_t ret = A1.cancelXferReq(req0);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req0) == NIXL_ERR_NOT_POSTED);
+    assert (A1.getXferStatus(req1) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+
+    // Not part of the batch anymore, so released right away
+    ret = A1.releaseXferReq(req0);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 1);
+
+    ret = wait_xfer(A1, req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 1));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 1 && notifs.front() == "xfer1");
+
+    // Canceled alone in the batch, the merged transfer is aborted
+    nixlXferReqH* req2 = make_req(A1, src, dst, 2);
+    assert (A1.postXferReq(req1) == NIXL_IN_PROG);
+    assert (A1.postXferReq(req2) == NIXL_IN_PROG);
+    ret = A1.cancelXferReq(req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 1);
+    ret = A1.cancelXferReq(req2);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (get_notifs(A2).empty());
+
+    ret = A1.releaseXferReq(req1);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.releaseXferReq(req2);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    testMemPolls = 1;
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    test_merge();
+    test_window();
+    test_release();
+    test_release_done();
+    test_cancel();
+
+    std::cout << "Test done\n";
+}
@@ -0,0 +1,279 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of the writes packed through staging buffers, with agents
+// of the same process over the test memory backend. The bytes are checked in
+// the destination descriptors of the target, which only gets them from its
+// getNotifs, and the initiator has to see the write in progress till then.
+
+std::string agent1("Agent001");
+std::string agent2("Agent002");
+std::string agent3("Agent003");
+
+static const size_t buf_len   = 1 << 16;
+static const size_t desc_len  = 100;
+static const size_t stride    = 256;
+static const int    n_descs   = 64;
+static const size_t stage_len = desc_len * n_descs;
+
+struct test_bufs_t {
+    std::vector<char> data    = std::vector<char>(buf_len);
+    std::vector<char> staging = std::vector<char>(stage_len);
+};
+
+static void init_agent(nixlAgent &agent, test_bufs_t &bufs) {
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret;
+
+    ret = agent.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) bufs.data.data(), buf_len, 0));
+    reg.addDesc(nixlBlobDesc((uintptr_t) bufs.staging.data(), stage_len, 0));
+    ret = agent.registerMem(reg);
+    assert (ret == NIXL_SUCCESS);
+}
+
+// The initiator loads the metadata of the target
+static void load_md(nixlAgent &initiator, nixlAgent &target) {
+    std::string meta, name;
+    nixl_status_t ret = target.getLocalMD(meta);
+    assert (ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(meta, name);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static void fill_buf(std::vector<char> &buf, const int seed) {
+    for (size_t i = 0; i < buf.size(); ++i)
+        buf[i] = (char) (i * 7 + seed);
+}
+
+static nixl_xfer_dlist_t make_dlist(std::vector<char> &buf) {
+    nixl_xfer_dlist_t dlist(DRAM_SEG);
+    for (int i = 0; i < n_descs; ++i)
+        dlist.addDesc(nixlBasicDesc((uintptr_t) buf.data() + i * stride,
+                                    desc_len, 0));
+    return dlist;
+}
+
+static bool same_bytes(std::vector<char> &src, std::vector<char> &dst) {
+    for (int i = 0; i < n_descs; ++i)
+        if (memcmp(src.data() + i * stride, dst.data() + i * stride, desc_len) != 0)
+            return false;
+    return true;
+}
+
+static nixlXferReqH* make_req(nixlAgent &agent, test_bufs_t &src, test_bufs_t &dst,
+                              const std::string &remote_agent,
+                              const std::string &notif_msg,
+                              const uint64_t timeout_us = 0) {
+    nixl_opt_args_t extra_params;
+    extra_params.timeoutUs         = timeout_us;
+    extra_params.packLocalStaging  = (uintptr_t) src.staging.data();
+    extra_params.packRemoteStaging = (uintptr_t) dst.staging.data();
+    extra_params.packStagingLen    = stage_len;
+    if (!notif_msg.empty()) {
+        extra_params.hasNotif = true;
+        extra_params.notifMsg = notif_msg;
+    }
+
+    nixlXferReqH* req;
+    nixl_status_t ret = agent.createXferReq(NIXL_WRITE, make_dlist(src.data),
+                                            make_dlist(dst.data), remote_agent,
+                                            req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    return req;
+}
+
+static std::vector<nixl_blob_t> get_notifs(nixlAgent &agent,
+                                           const std::string &remote_agent) {
+    nixl_notifs_t notif_map;
+    nixl_status_t ret = agent.getNotifs(notif_map);
+    assert (ret == NIXL_SUCCESS);
+    return notif_map[remote_agent];
+}
+
+static void test_pack() {
+    std::cout << "Packed write test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.packXfers = true;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    test_bufs_t src, dst;
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    load_md(A2, A1);
+    fill_buf(src.data, 1);
+
+    nixlXferReqH* req = make_req(A1, src, dst, agent2, "packed");
+
+    // Only the staging is written till the target scatters it
+    nixl_status_t ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    for (int i = 0; i < 10; ++i)
+        assert (A1.getXferStatus(req) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+    assert (!same_bytes(src.data, dst.data));
+
+    // The staging can't be overwritten by a repost meanwhile
+    nixlXferReqH* repost = make_req(A1, src, dst, agent2, "");
+    ret = A1.postXferReq(repost);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.postXferReq(repost);
+    assert (ret == NIXL_ERR_REPOST_ACTIVE);
+
+    // Only the user message is given to the target, after the scatter
+    std::vector<nixl_blob_t> notifs = get_notifs(A2, agent1);
+    assert (notifs.size() == 1 && notifs.front() == "packed");
+    assert (same_bytes(src.data, dst.data));
+
+    ret = A1.getXferStatus(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (get_notifs(A1, agent2).empty());
+
+    // Reposted once acknowledged, with new data
+    fill_buf(src.data, 2);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (A1.getXferStatus(req) == NIXL_IN_PROG);
+    assert (get_notifs(A2, agent1).size() == 1);
+    assert (same_bytes(src.data, dst.data));
+    while ((ret = A1.getXferStatus(req)) == NIXL_IN_PROG);
+    assert (ret == NIXL_SUCCESS);
+
+    // User messages sent along are not taken for packed ones or acks
+    nixl_blob_t fake("NIXLPACK");
+    fake.resize(256, 'x');
+    ret = A1.genNotif(agent2, fake);
+    assert (ret == NIXL_SUCCESS);
+    ret = A2.genNotif(agent1, "NIXLPACA" + fake);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (A1.getXferStatus(req) == NIXL_IN_PROG);
+    assert (get_notifs(A2, agent1) == std::vector<nixl_blob_t>({fake, "packed"}));
+    while ((ret = A1.getXferStatus(req)) == NIXL_IN_PROG);
+    assert (ret == NIXL_SUCCESS);
+    notifs = get_notifs(A1, agent2);
+    assert (notifs.size() == 1 && notifs.front() == "NIXLPACA" + fake);
+
+    // Released while waiting for the ack, which is then ignored
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (A1.getXferStatus(req) == NIXL_IN_PROG);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (get_notifs(A2, agent1).size() == 1);
+    assert (get_notifs(A1, agent2).empty());
+    assert (testMemLive == 0);
+
+    // A target not reading its notifications in time fails the write with
+    // its deadline, and the initiator keeps the other notifications it read
+    req = make_req(A1, src, dst, agent2, "late", 2000);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    ret = A2.genNotif(agent1, "unrelated");
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req) == NIXL_IN_PROG);
+    std::this_thread::sleep_for(std::chrono::microseconds(3000));
+    assert (A1.getXferStatus(req) == NIXL_ERR_TIMEOUT);
+    assert (testMemLive == 0);
+    notifs = get_notifs(A1, agent2);
+    assert (notifs.size() == 1 && notifs.front() == "unrelated");
+
+    // The late ack of the scatter is ignored
+    assert (get_notifs(A2, agent1).size() == 1);
+    assert (get_notifs(A1, agent2).empty());
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+
+    // Destinations no longer registered by the target are not written,
+    // and the initiator gets the failure with the ack
+    req = make_req(A1, src, dst, agent2, "dropped");
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) dst.data.data(), buf_len, 0));
+    ret = A2.deregisterMem(reg);
+    assert (ret == NIXL_SUCCESS);
+    memset(dst.data.data(), 0, buf_len);
+
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (A1.getXferStatus(req) == NIXL_IN_PROG);
+    nixl_notifs_t notif_map;
+    ret = A2.getNotifs(notif_map);
+    assert (ret == NIXL_ERR_NOT_FOUND);
+    assert (notif_map.empty());
+    assert (!same_bytes(src.data, dst.data));
+
+    while ((ret = A1.getXferStatus(req)) == NIXL_IN_PROG);
+    assert (ret == NIXL_ERR_NOT_FOUND);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+}
+
+static void test_no_pack() {
+    std::cout << "Write to an agent not packing test\n";
+
+    nixlAgentConfig cfg(false), cfg3(false);
+    cfg.packXfers = true;
+    nixlAgent A1(agent1, cfg), A3(agent3, cfg3);
+
+    test_bufs_t src, dst;
+    init_agent(A1, src);
+    init_agent(A3, dst);
+    load_md(A1, A3);
+    fill_buf(src.data, 3);
+
+    // Sent directly, complete without the target reading its notifications
+    nixlXferReqH* req = make_req(A1, src, dst, agent3, "direct");
+    nixl_status_t ret = A1.postXferReq(req);
+    assert (ret >= 0);
+    while ((ret = A1.getXferStatus(req)) == NIXL_IN_PROG);
+    assert (ret == NIXL_SUCCESS);
+    assert (same_bytes(src.data, dst.data));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A3, agent1);
+    assert (notifs.size() == 1 && notifs.front() == "direct");
+
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    test_pack();
+    test_no_pack();
+
+    std::cout << "Test done\n";
+}
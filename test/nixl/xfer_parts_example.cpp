@@ -0,0 +1,605 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of the transfer requests made of several parts, with agents
+// of the same process over the test memory backend. Each case checks the bytes
+// received, the completion and notifications of the requests, and that they
+// can be released with no backend handle left behind.
+
+std::string agent1("Agent001");
+std::string agent2("Agent002");
+std::string agent3("Agent003");
+
+static const size_t buf_len = 1 << 20;
+
+static void init_agent(nixlAgent &agent, std::vector<char> &buf,
+                       const bool both_backends) {
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret;
+
+    ret = agent.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+    if (both_backends) {
+        ret = agent.createBackend("TEST_MEM2", params, backend);
+        assert (ret == NIXL_SUCCESS);
+    }
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf.data(), buf.size(), 0));
+    ret = agent.registerMem(reg);
+    assert (ret == NIXL_SUCCESS);
+}
+
+// The initiator loads the metadata of the target
+static void load_md(nixlAgent &initiator, nixlAgent &target) {
+    std::string meta, name;
+    nixl_status_t ret = target.getLocalMD(meta);
+    assert (ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(meta, name);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static void fill_buf(std::vector<char> &buf, const int seed) {
+    for (size_t i = 0; i < buf.size(); ++i)
+        buf[i] = (char) (i * 7 + seed);
+}
+
+// Descriptors are stride bytes apart, or contiguous by default
+static nixl_xfer_dlist_t make_dlist(std::vector<char> &buf, const size_t offset,
+                                    const size_t len, const int count = 1,
+                                    const size_t stride = 0) {
+    nixl_xfer_dlist_t dlist(DRAM_SEG);
+    for (int i = 0; i < count; ++i)
+        dlist.addDesc(nixlBasicDesc((uintptr_t) buf.data() + offset +
+                                    i * (stride ? stride : len), len, 0));
+    return dlist;
+}
+
+static nixl_status_t wait_xfer(nixlAgent &agent, nixlXferReqH* req) {
+    nixl_status_t status;
+    while ((status = agent.getXferStatus(req)) == NIXL_IN_PROG);
+    return status;
+}
+
+static std::vector<nixl_blob_t> get_notifs(nixlAgent &agent,
+                                           const std::string &remote_agent) {
+    nixl_notifs_t notif_map;
+    nixl_status_t ret = agent.getNotifs(notif_map);
+    assert (ret == NIXL_SUCCESS);
+    return notif_map[remote_agent];
+}
+
+static void test_striping() {
+    std::cout << "Striping test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.stripeXfers     = true;
+    cfg.stripeChunkSize = 4096;
+    cfg.enableTelemetry = true;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src, true);
+    init_agent(A2, dst, true);
+    load_md(A1, A2);
+    fill_buf(src, 1);
+
+    nixl_xfer_dlist_t local  = make_dlist(src, 0, buf_len);
+    nixl_xfer_dlist_t remote = make_dlist(dst, 0, buf_len);
+
+    nixl_opt_args_t extra_params;
+    extra_params.notifMsg = "striped";
+    extra_params.hasNotif = true;
+
+    nixlXferReqH* req;
+    nixl_status_t ret = A1.createXferReq(NIXL_WRITE, local, remote, agent2,
+                                         req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+
+    // The notification is sent once all the stripes completed
+    testMemPolls = 2;
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (get_notifs(A2, agent1).empty());
+
+    ret = wait_xfer(A1, req);
+    assert (ret == NIXL_SUCCESS);
+    assert (memcmp(src.data(), dst.data(), buf_len) == 0);
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2, agent1);
+    assert (notifs.size() == 1);
+    assert (notifs.front() == "striped");
+
+    // Both backends carried a part, at chunk boundaries
+    nixl_agent_stats_t stats;
+    ret = A1.getStats(stats);
+    assert (ret == NIXL_SUCCESS);
+    uint64_t bytes1 = stats.backends["TEST_MEM"][NIXL_WRITE].totalBytes;
+    uint64_t bytes2 = stats.backends["TEST_MEM2"][NIXL_WRITE].totalBytes;
+    assert (bytes1 > 0 && bytes2 > 0);
+    assert (bytes1 + bytes2 == buf_len);
+    assert (bytes1 % cfg.stripeChunkSize == 0);
+    assert (stats.peers[agent2][NIXL_WRITE].xferCount == 1);
+
+    // Reposted once completed
+    memset(dst.data(), 0, buf_len);
+    ret = A1.postXferReq(req);
+    assert (ret >= 0);
+    ret = wait_xfer(A1, req);
+    assert (ret == NIXL_SUCCESS);
+    assert (memcmp(src.data(), dst.data(), buf_len) == 0);
+    assert (get_notifs(A2, agent1).size() == 1);
+
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+
+    // Canceled in progress, the stripes are given up and nothing is notified
+    testMemPolls = 1000;
+    ret = A1.createXferReq(NIXL_WRITE, local, remote, agent2, req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.cancelXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req) == NIXL_ERR_NOT_POSTED);
+    assert (A1.postXferReq(req) == NIXL_ERR_NOT_ALLOWED);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (get_notifs(A2, agent1).empty());
+    testMemPolls = 1;
+}
+
+static void test_chain() {
+    std::cout << "Chained posts test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src, false);
+    init_agent(A2, dst, false);
+    load_md(A1, A2);
+    fill_buf(src, 2);
+
+    size_t half = buf_len / 2;
+    nixl_xfer_dlist_t local1  = make_dlist(src, 0, half);
+    nixl_xfer_dlist_t remote1 = make_dlist(dst, 0, half);
+    nixl_xfer_dlist_t local2  = make_dlist(src, half, half);
+    nixl_xfer_dlist_t remote2 = make_dlist(dst, half, half);
+
+    nixlXferReqH *req1, *req2;
+    nixl_status_t ret;
+
+    nixl_opt_args_t extra_params;
+    extra_params.hasNotif = true;
+    extra_params.notifMsg = "first";
+    ret = A1.createXferReq(NIXL_WRITE, local1, remote1, agent2, req1, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    extra_params.notifMsg = "second";
+    ret = A1.createXferReq(NIXL_WRITE, local2, remote2, agent2, req2, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+
+    // The second post waits for the first one, without a backend transfer
+    testMemPolls = 2;
+    ret = A1.postXferReq(req1);
+    assert (ret == NIXL_IN_PROG);
+
+    nixl_opt_args_t chain_params;
+    chain_params.hasNotif = true;
+    chain_params.notifMsg = "second";
+    chain_params.dependsOn.push_back(req1);
+    ret = A1.postXferReq(req2, &chain_params);
+    assert (ret == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+
+    // Started by the agent from the status calls of the second one only
+    ret = wait_xfer(A1, req2);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req1) == NIXL_SUCCESS);
+    assert (memcmp(src.data(), dst.data(), buf_len) == 0);
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2, agent1);
+    assert (notifs.size() == 2);
+    assert (notifs[0] == "first");
+    assert (notifs[1] == "second");
+
+    // A post chained after a canceled one fails without being started
+    testMemPolls = 1000;
+    ret = A1.postXferReq(req1);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.postXferReq(req2, &chain_params);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.cancelXferReq(req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req2) == NIXL_ERR_NOT_POSTED);
+    assert (get_notifs(A2, agent1).empty());
+
+    ret = A1.releaseXferReq(req1);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.releaseXferReq(req2);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+
+    // A waiting post is dropped when released
+    ret = A1.createXferReq(NIXL_WRITE, local1, remote1, agent2, req1);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.createXferReq(NIXL_WRITE, local2, remote2, agent2, req2);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req1);
+    assert (ret == NIXL_IN_PROG);
+    chain_params.dependsOn = {req1};
+    ret = A1.postXferReq(req2, &chain_params);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.releaseXferReq(req2);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 1);
+    ret = A1.releaseXferReq(req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (get_notifs(A2, agent1).empty());
+    testMemPolls = 1;
+}
+
+static void test_segments() {
+    std::cout << "Segments test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src, false);
+    init_agent(A2, dst, false);
+    load_md(A1, A2);
+    fill_buf(src, 3);
+
+    // One descriptor in the first segment, three in the second
+    size_t            len    = buf_len / 4;
+    nixl_xfer_dlist_t local  = make_dlist(src, 0, len, 4);
+    nixl_xfer_dlist_t remote = make_dlist(dst, 0, len, 4);
+
+    nixl_opt_args_t extra_params;
+    extra_params.segments      = {1, 3};
+    extra_params.segmentNotifs = {"segment0", "segment1"};
+    extra_params.notifMsg      = "all";
+    extra_params.hasNotif      = true;
+
+    nixlXferReqH* req;
+    nixl_status_t ret = A1.createXferReq(NIXL_WRITE, local, remote, agent2,
+                                         req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+
+    testMemPolls = 2;
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+
+    // The first segment completes, and is notified, before the second one
+    nixl_xfer_progress_t progress;
+    do {
+        ret = A1.getXferProgress(req, progress);
+        assert (ret == NIXL_IN_PROG);
+        assert (progress.segmentsDone.size() == 2);
+        assert (progress.totalBytes == buf_len);
+    } while (!progress.segmentsDone[0]);
+    assert (!progress.segmentsDone[1]);
+    assert (progress.doneBytes == len);
+    assert (memcmp(src.data(), dst.data(), len) == 0);
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2, agent1);
+    assert (notifs.size() == 1);
+    assert (notifs.front() == "segment0");
+
+    ret = wait_xfer(A1, req);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.getXferProgress(req, progress);
+    assert (ret == NIXL_SUCCESS);
+    assert (progress.segmentsDone[0] && progress.segmentsDone[1]);
+    assert (progress.doneBytes == buf_len);
+    assert (memcmp(src.data(), dst.data(), buf_len) == 0);
+
+    // The notification of the request comes after the segment ones
+    notifs = get_notifs(A2, agent1);
+    assert (notifs.size() == 2);
+    assert (notifs[0] == "segment1");
+    assert (notifs[1] == "all");
+
+    // Released in progress, the segments are aborted
+    testMemPolls = 1000;
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (testMemLive == 2);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (get_notifs(A2, agent1).empty());
+    testMemPolls = 1;
+}
+
+static void test_stream() {
+    std::cout << "Stream test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src, false);
+    init_agent(A2, dst, false);
+    load_md(A1, A2);
+    fill_buf(src, 4);
+
+    // The first chunk is larger, so it completes after the second one
+    size_t            len    = buf_len / 4;
+    nixl_xfer_dlist_t local  = make_dlist(src, 0, len, 4);
+    nixl_xfer_dlist_t remote = make_dlist(dst, 0, len, 4);
+
+    nixl_opt_args_t extra_params;
+    extra_params.segments = {3, 1};
+
+    nixlXferReqH*    req;
+    nixlXferStreamH* stream;
+    nixl_status_t ret = A1.createXferReq(NIXL_WRITE, local, remote, agent2,
+                                         req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.createXferStream(req, stream);
+    assert (ret == NIXL_SUCCESS);
+
+    // The request is driven by its stream only
+    assert (A1.postXferReq(req) == NIXL_ERR_NOT_ALLOWED);
+    assert (A1.releaseXferReq(req) == NIXL_ERR_NOT_ALLOWED);
+
+    testMemPolls = 2;
+    for (int round = 0; round < 2; ++round) {
+        memset(dst.data(), 0, buf_len);
+
+        ret = A1.postXferChunk(stream, "chunk0");
+        assert (ret == NIXL_IN_PROG);
+        ret = A1.postXferChunk(stream, "chunk1");
+        assert (ret == NIXL_IN_PROG);
+        assert (A1.postXferChunk(stream) == NIXL_ERR_REPOST_ACTIVE);
+
+        // The notifications arrive in chunk order
+        std::vector<nixl_blob_t> notifs;
+        do {
+            ret = A1.getXferStreamStatus(stream);
+            assert (ret >= 0);
+            for (auto & msg : get_notifs(A2, agent1))
+                notifs.push_back(msg);
+        } while (ret == NIXL_IN_PROG);
+
+        assert (memcmp(src.data(), dst.data(), buf_len) == 0);
+        for (auto & msg : get_notifs(A2, agent1))
+            notifs.push_back(msg);
+        assert (notifs.size() == 2);
+        assert (notifs[0] == "chunk0");
+        assert (notifs[1] == "chunk1");
+    }
+
+    // Released with a chunk in progress, which is aborted, while the
+    // completed chunk keeps its backend handle till the request is released
+    testMemPolls = 1000;
+    ret = A1.postXferChunk(stream, "chunk0");
+    assert (ret == NIXL_IN_PROG);
+    assert (testMemLive == 2);
+    ret = A1.releaseXferStream(stream);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 1);
+    assert (get_notifs(A2, agent1).empty());
+
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    testMemPolls = 1;
+}
+
+static void test_broadcast() {
+    std::cout << "Broadcast test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg), A3(agent3, cfg);
+
+    std::vector<char> src(buf_len), dst2(buf_len), dst3(buf_len);
+    init_agent(A1, src, false);
+    init_agent(A2, dst2, false);
+    init_agent(A3, dst3, false);
+    load_md(A1, A2);
+    load_md(A1, A3);
+    fill_buf(src, 5);
+
+    size_t            len   = buf_len / 2;
+    nixl_xfer_dlist_t local = make_dlist(src, 0, len, 2);
+    std::vector<nixl_xfer_dlist_t> remotes = {make_dlist(dst2, 0, len, 2),
+                                              make_dlist(dst3, 0, len, 2)};
+    std::vector<std::string>       agents  = {agent2, agent3};
+
+    nixl_opt_args_t extra_params;
+    extra_params.notifMsg = "bcast";
+    extra_params.hasNotif = true;
+
+    nixlXferReqH* req;
+    nixl_status_t ret = A1.createBcastXferReq(local, remotes, agents, req,
+                                              &extra_params);
+    assert (ret == NIXL_SUCCESS);
+
+    // Each destination gets the data and the notification once
+    testMemPolls = 2;
+    for (int iter = 0; iter < 2; ++iter) {
+        memset(dst2.data(), 0, buf_len);
+        memset(dst3.data(), 0, buf_len);
+
+        ret = A1.postXferReq(req);
+        assert (ret == NIXL_IN_PROG);
+        ret = wait_xfer(A1, req);
+        assert (ret == NIXL_SUCCESS);
+        assert (memcmp(src.data(), dst2.data(), buf_len) == 0);
+        assert (memcmp(src.data(), dst3.data(), buf_len) == 0);
+
+        std::vector<nixl_blob_t> notifs2 = get_notifs(A2, agent1);
+        std::vector<nixl_blob_t> notifs3 = get_notifs(A3, agent1);
+        assert (notifs2.size() == 1 && notifs2.front() == "bcast");
+        assert (notifs3.size() == 1 && notifs3.front() == "bcast");
+    }
+
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+
+    // Canceled in progress, the writes to all the destinations are given up
+    testMemPolls = 1000;
+    ret = A1.createBcastXferReq(local, remotes, agents, req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (testMemLive == 2);
+    ret = A1.cancelXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req) == NIXL_ERR_NOT_POSTED);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (get_notifs(A2, agent1).empty());
+    assert (get_notifs(A3, agent1).empty());
+
+    // A destination other than the first invalidated in progress fails the
+    // whole request, which is released by the agent with its backend handles
+    ret = A1.createBcastXferReq(local, remotes, agents, req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.invalidateRemoteMD(agent3);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req) == NIXL_ERR_NOT_FOUND);
+    assert (testMemLive == 0);
+    load_md(A1, A3);
+    testMemPolls = 1;
+
+    // A destination invalidated before the post fails the whole request,
+    // which is released by the agent
+    ret = A1.createBcastXferReq(local, remotes, agents, req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.invalidateRemoteMD(agent3);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_ERR_NOT_FOUND);
+    assert (testMemLive == 0);
+}
+
+static void test_gather() {
+    std::cout << "Gather test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg), A3(agent3, cfg);
+
+    std::vector<char> dst(buf_len), src2(buf_len), src3(buf_len);
+    init_agent(A1, dst, false);
+    init_agent(A2, src2, false);
+    init_agent(A3, src3, false);
+    load_md(A1, A2);
+    load_md(A1, A3);
+    fill_buf(src2, 6);
+    fill_buf(src3, 7);
+
+    // The first quarter of the buffer from the first source, in one
+    // descriptor, and the first halves of the other quarters from the
+    // second one, in three descriptors whose reads take longer
+    size_t len = buf_len / 4;
+    std::vector<nixl_xfer_dlist_t> locals  = {make_dlist(dst, 0, len),
+                                              make_dlist(dst, len, len / 2, 3, len)};
+    std::vector<nixl_xfer_dlist_t> remotes = {make_dlist(src2, 0, len),
+                                              make_dlist(src3, len, len / 2, 3, len)};
+    std::vector<std::string>       agents  = {agent2, agent3};
+
+    nixl_opt_args_t extra_params;
+    extra_params.notifMsg = "gather";
+    extra_params.hasNotif = true;
+
+    nixlXferReqH* req;
+    nixl_status_t ret = A1.createGatherXferReq(locals, remotes, agents, req,
+                                               &extra_params);
+    assert (ret == NIXL_SUCCESS);
+
+    testMemPolls = 2;
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    assert (testMemLive == 2);
+
+    // The first source is notified as soon as its own reads completed
+    std::vector<nixl_blob_t> notifs2;
+    while (notifs2.empty()) {
+        ret = A1.getXferStatus(req);
+        assert (ret == NIXL_IN_PROG);
+        notifs2 = get_notifs(A2, agent1);
+    }
+    assert (notifs2.size() == 1 && notifs2.front() == "gather");
+    assert (get_notifs(A3, agent1).empty());
+
+    ret = wait_xfer(A1, req);
+    assert (ret == NIXL_SUCCESS);
+    assert (memcmp(dst.data(), src2.data(), len) == 0);
+    for (size_t offset = len; offset < buf_len; offset += len)
+        assert (memcmp(dst.data() + offset, src3.data() + offset, len / 2) == 0);
+
+    std::vector<nixl_blob_t> notifs3 = get_notifs(A3, agent1);
+    assert (notifs3.size() == 1 && notifs3.front() == "gather");
+    assert (get_notifs(A2, agent1).empty());
+
+    // Released in progress, the reads from all the sources are aborted
+    testMemPolls = 1000;
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.releaseXferReq(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (get_notifs(A2, agent1).empty());
+    assert (get_notifs(A3, agent1).empty());
+
+    // A source other than the first invalidated in progress fails the whole
+    // request, which is released by the agent with its backend handles
+    ret = A1.createGatherXferReq(locals, remotes, agents, req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    ret = A1.postXferReq(req);
+    assert (ret == NIXL_IN_PROG);
+    ret = A1.invalidateRemoteMD(agent3);
+    assert (ret == NIXL_SUCCESS);
+    nixl_xfer_progress_t progress;
+    assert (A1.getXferProgress(req, progress) == NIXL_ERR_NOT_FOUND);
+    assert (testMemLive == 0);
+    testMemPolls = 1;
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    test_striping();
+    test_chain();
+    test_segments();
+    test_stream();
+    test_broadcast();
+    test_gather();
+
+    std::cout << "Test done\n";
+}
@@ -0,0 +1,319 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of the transfer limits of peers and backends, with agents
+// of the same process over the test memory backends, whose transfers are kept
+// in progress by testMemPolls. Held posts are only given to the backends from
+// getXferStatus calls, which testMemLive shows.
+
+std::string agent1("Agent001");
+std::string agent2("Agent002");
+
+static const size_t buf_len  = 1 << 16;
+static const size_t xfer_len = 4096;
+
+// Returns the backends created, TEST_MEM first
+static std::vector<nixlBackendH*> init_agent(nixlAgent &agent,
+                                             std::vector<char> &buf,
+                                             const bool both_backends = false) {
+    nixl_b_params_t            params;
+    nixlBackendH*              backend;
+    std::vector<nixlBackendH*> backends;
+    nixl_status_t              ret;
+
+    ret = agent.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+    backends.push_back(backend);
+    if (both_backends) {
+        ret = agent.createBackend("TEST_MEM2", params, backend);
+        assert (ret == NIXL_SUCCESS);
+        backends.push_back(backend);
+    }
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf.data(), buf.size(), 0));
+    ret = agent.registerMem(reg);
+    assert (ret == NIXL_SUCCESS);
+    return backends;
+}
+
+// The initiator loads the metadata of the target
+static void load_md(nixlAgent &initiator, nixlAgent &target) {
+    std::string meta, name;
+    nixl_status_t ret = target.getLocalMD(meta);
+    assert (ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(meta, name);
+    assert (ret == NIXL_SUCCESS);
+}
+
+static void fill_buf(std::vector<char> &buf, const int seed) {
+    for (size_t i = 0; i < buf.size(); ++i)
+        buf[i] = (char) (i * 7 + seed);
+}
+
+// Write of len bytes from the index-th xfer_len bytes of src to the same
+// place in dst, notified with its index
+static nixlXferReqH* make_req(nixlAgent &agent, std::vector<char> &src,
+                              std::vector<char> &dst, const size_t index,
+                              const size_t len = xfer_len,
+                              nixlBackendH* backend = nullptr) {
+    nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    local.addDesc(nixlBasicDesc((uintptr_t) src.data() + index * xfer_len, len, 0));
+    remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + index * xfer_len, len, 0));
+
+    nixl_opt_args_t extra_params;
+    extra_params.hasNotif = true;
+    extra_params.notifMsg = "xfer" + std::to_string(index);
+    if (backend)
+        extra_params.backends.push_back(backend);
+
+    nixlXferReqH* req;
+    nixl_status_t ret = agent.createXferReq(NIXL_WRITE, local, remote, agent2,
+                                            req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    return req;
+}
+
+static bool same_bytes(std::vector<char> &src, std::vector<char> &dst,
+                       const size_t index, const size_t len = xfer_len) {
+    return memcmp(src.data() + index * xfer_len, dst.data() + index * xfer_len,
+                  len) == 0;
+}
+
+static nixl_status_t wait_xfer(nixlAgent &agent, nixlXferReqH* req) {
+    nixl_status_t status;
+    while ((status = agent.getXferStatus(req)) == NIXL_IN_PROG);
+    return status;
+}
+
+static std::vector<nixl_blob_t> get_notifs(nixlAgent &agent) {
+    nixl_notifs_t notif_map;
+    nixl_status_t ret = agent.getNotifs(notif_map);
+    assert (ret == NIXL_SUCCESS);
+    return notif_map[agent1];
+}
+
+static void test_byte_cap() {
+    std::cout << "Peer byte cap test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 1);
+
+    nixl_xfer_limits_t limits;
+    limits.maxInflightBytes = xfer_len;
+    assert (A1.setPeerLimits(agent2, limits) == NIXL_SUCCESS);
+
+    nixlXferReqH* req0 = make_req(A1, src, dst, 0);
+    nixlXferReqH* req1 = make_req(A1, src, dst, 1);
+
+    // Over the cap, the second post is held without going to the backend
+    testMemPolls = 100;
+    assert (A1.postXferReq(req0) == NIXL_IN_PROG);
+    assert (A1.postXferReq(req1) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+    assert (!same_bytes(src, dst, 1));
+
+    // Polling only the held one completes the first and then starts it
+    nixl_status_t ret = wait_xfer(A1, req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req0) == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 0) && same_bytes(src, dst, 1));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 2);
+    assert (notifs[0] == "xfer0" && notifs[1] == "xfer1");
+
+    // A single transfer over the cap still starts when nothing is in progress
+    nixlXferReqH* large = make_req(A1, src, dst, 2, 2 * xfer_len);
+    assert (A1.postXferReq(large) == NIXL_IN_PROG);
+    assert (testMemLive == 3);
+    ret = wait_xfer(A1, large);
+    assert (ret == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 2, 2 * xfer_len));
+    assert (get_notifs(A2).size() == 1);
+    testMemPolls = 1;
+
+    for (nixlXferReqH* req : {req0, req1, large})
+        assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+}
+
+static void test_order() {
+    std::cout << "Peer order test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 2);
+
+    nixl_xfer_limits_t limits;
+    limits.maxInflightBytes = 2 * xfer_len;
+    assert (A1.setPeerLimits(agent2, limits) == NIXL_SUCCESS);
+
+    // The small last post fits the cap, but waits behind the held one
+    testMemPolls = 100;
+    std::vector<nixlXferReqH*> reqs;
+    reqs.push_back(make_req(A1, src, dst, 0));
+    reqs.push_back(make_req(A1, src, dst, 1, 2 * xfer_len));
+    reqs.push_back(make_req(A1, src, dst, 3));
+    for (auto & req : reqs)
+        assert (A1.postXferReq(req) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+
+    // Each one fills the cap with the one before, so they run one at a time,
+    // in order of post as the notifications show
+    nixl_status_t ret = wait_xfer(A1, reqs.back());
+    assert (ret == NIXL_SUCCESS);
+    for (auto & req : reqs)
+        assert (A1.getXferStatus(req) == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 0, 4 * xfer_len));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 3);
+    assert (notifs[0] == "xfer0" && notifs[1] == "xfer1" && notifs[2] == "xfer3");
+    testMemPolls = 1;
+
+    for (auto & req : reqs)
+        assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+}
+
+static void test_reject() {
+    std::cout << "Peer reject test\n";
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+    fill_buf(src, 3);
+
+    nixl_xfer_limits_t limits;
+    limits.maxInflightReqs = 1;
+    limits.reject          = true;
+    assert (A1.setPeerLimits(agent2, limits) == NIXL_SUCCESS);
+
+    nixlXferReqH* req0 = make_req(A1, src, dst, 0);
+    nixlXferReqH* req1 = make_req(A1, src, dst, 1);
+
+    // Rejected, the request is left as it was
+    testMemPolls = 100;
+    assert (A1.postXferReq(req0) == NIXL_IN_PROG);
+    assert (A1.postXferReq(req1) == NIXL_ERR_OVER_LIMIT);
+    assert (A1.postXferReq(req1) == NIXL_ERR_OVER_LIMIT);
+    assert (testMemLive == 1);
+    assert (A1.getXferStatus(req1) == NIXL_ERR_NOT_POSTED);
+
+    // Nothing is held for it, so it never starts by itself
+    nixl_status_t ret = wait_xfer(A1, req0);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.getXferStatus(req1) == NIXL_ERR_NOT_POSTED);
+    assert (!same_bytes(src, dst, 1));
+
+    // Posted again once within the limit, it completes as any other
+    assert (A1.postXferReq(req1) == NIXL_IN_PROG);
+    ret = wait_xfer(A1, req1);
+    assert (ret == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 0) && same_bytes(src, dst, 1));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 2);
+    assert (notifs[0] == "xfer0" && notifs[1] == "xfer1");
+    testMemPolls = 1;
+
+    for (nixlXferReqH* req : {req0, req1})
+        assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+}
+
+static void test_backend_limit() {
+    std::cout << "Backend limit of striped posts test\n";
+
+    nixlAgentConfig cfg(false);
+    cfg.stripeXfers     = true;
+    cfg.stripeChunkSize = xfer_len;
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+    std::vector<char> src(buf_len), dst(buf_len);
+    std::vector<nixlBackendH*> backends = init_agent(A1, src, true);
+    init_agent(A2, dst, true);
+    load_md(A1, A2);
+    fill_buf(src, 4);
+
+    // One transfer at a time through the second backend only
+    nixl_xfer_limits_t limits;
+    limits.maxInflightReqs = 1;
+    assert (A1.setBackendLimits(backends[1], limits) == NIXL_SUCCESS);
+
+    nixlXferReqH* striped0 = make_req(A1, src, dst, 0, 4 * xfer_len);
+    nixlXferReqH* striped1 = make_req(A1, src, dst, 4, 4 * xfer_len);
+    nixlXferReqH* single   = make_req(A1, src, dst, 8, xfer_len, backends[0]);
+
+    // A stripe of the second post would go over the limit, so none of its
+    // stripes start, while a post through the other backend is not held
+    testMemPolls = 100;
+    assert (A1.postXferReq(striped0) == NIXL_IN_PROG);
+    assert (testMemLive == 2);
+    assert (A1.postXferReq(striped1) == NIXL_IN_PROG);
+    assert (testMemLive == 2);
+    assert (A1.postXferReq(single) == NIXL_IN_PROG);
+    assert (testMemLive == 3);
+    assert (!same_bytes(src, dst, 4, 4 * xfer_len));
+
+    nixl_status_t ret = wait_xfer(A1, striped1);
+    assert (ret == NIXL_SUCCESS);
+    for (nixlXferReqH* req : {striped0, single})
+        assert (wait_xfer(A1, req) == NIXL_SUCCESS);
+    assert (same_bytes(src, dst, 0, 9 * xfer_len));
+
+    std::vector<nixl_blob_t> notifs = get_notifs(A2);
+    assert (notifs.size() == 3);
+    testMemPolls = 1;
+
+    for (nixlXferReqH* req : {striped0, striped1, single})
+        assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    test_byte_cap();
+    test_order();
+    test_reject();
+    test_backend_limit();
+
+    std::cout << "Test done\n";
+    return 0;
+}
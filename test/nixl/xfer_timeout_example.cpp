@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "nixl.h"
+#include "test_mem_backend.h"
+
+// Functional test of the transfer deadlines and cancellation, with agents of
+// the same process over the test memory backend, whose transfers are kept in
+// progress by testMemPolls. Deadlines are checked when the agent polls the
+// transfers, either the user's getXferStatus or the dispatch of held posts.
+
+std::string agent1("Agent001");
+std::string agent2("Agent002");
+
+static const size_t buf_len  = 1 << 16;
+static const size_t xfer_len = 4096;
+
+static void init_agent(nixlAgent &agent, std::vector<char> &buf) {
+    nixl_b_params_t params;
+    nixlBackendH*   backend;
+    nixl_status_t   ret;
+
+    ret = agent.createBackend("TEST_MEM", params, backend);
+    assert (ret == NIXL_SUCCESS);
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc((uintptr_t) buf.data(), buf.size(), 0));
+    ret = agent.registerMem(reg);
+    assert (ret == NIXL_SUCCESS);
+}
+
+// The initiator loads the metadata of the target
+static void load_md(nixlAgent &initiator, nixlAgent &target) {
+    std::string meta, name;
+    nixl_status_t ret = target.getLocalMD(meta);
+    assert (ret == NIXL_SUCCESS);
+    ret = initiator.loadRemoteMD(meta, name);
+    assert (ret == NIXL_SUCCESS);
+}
+
+// A write of the index-th xfer_len bytes, with a deadline if timeout_us
+static nixlXferReqH* make_req(nixlAgent &agent, std::vector<char> &src,
+                              std::vector<char> &dst, const int index,
+                              const uint64_t timeout_us) {
+    nixl_xfer_dlist_t local(DRAM_SEG), remote(DRAM_SEG);
+    local.addDesc(nixlBasicDesc((uintptr_t) src.data() + index * xfer_len,
+                                xfer_len, 0));
+    remote.addDesc(nixlBasicDesc((uintptr_t) dst.data() + index * xfer_len,
+                                 xfer_len, 0));
+
+    nixl_opt_args_t extra_params;
+    extra_params.timeoutUs = timeout_us;
+
+    nixlXferReqH* req;
+    nixl_status_t ret = agent.createXferReq(NIXL_WRITE, local, remote, agent2,
+                                            req, &extra_params);
+    assert (ret == NIXL_SUCCESS);
+    return req;
+}
+
+static void sleep_us(const uint64_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+static void test_polled(nixlAgent &A1, std::vector<char> &src,
+                        std::vector<char> &dst) {
+    std::cout << "Polled deadline test\n";
+
+    // Completed before its deadline
+    nixlXferReqH* req = make_req(A1, src, dst, 0, 10000000);
+    nixl_status_t ret = A1.postXferReq(req);
+    while (ret == NIXL_IN_PROG)
+        ret = A1.getXferStatus(req);
+    assert (ret == NIXL_SUCCESS);
+    assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+
+    // Canceled by the status poll past its deadline, and can't be reposted
+    testMemPolls = 1000000;
+    req = make_req(A1, src, dst, 0, 2000);
+    assert (A1.postXferReq(req) == NIXL_IN_PROG);
+    assert (A1.getXferStatus(req) == NIXL_IN_PROG);
+    sleep_us(3000);
+    assert (A1.getXferStatus(req) == NIXL_ERR_TIMEOUT);
+    assert (A1.getXferStatus(req) == NIXL_ERR_TIMEOUT);
+    assert (testMemLive == 0);
+    assert (A1.postXferReq(req) == NIXL_ERR_NOT_ALLOWED);
+    assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+
+    // Canceled by the user
+    req = make_req(A1, src, dst, 0, 0);
+    assert (A1.postXferReq(req) == NIXL_IN_PROG);
+    assert (A1.cancelXferReq(req) == NIXL_SUCCESS);
+    assert (A1.cancelXferReq(req) == NIXL_SUCCESS);
+    assert (testMemLive == 0);
+    assert (A1.getXferStatus(req) == NIXL_ERR_NOT_POSTED);
+    assert (A1.postXferReq(req) == NIXL_ERR_NOT_ALLOWED);
+    assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+    testMemPolls = 1;
+}
+
+static void test_unpolled(nixlAgent &A1, std::vector<char> &src,
+                          std::vector<char> &dst) {
+    std::cout << "Unpolled deadline test\n";
+
+    // One transfer at a time to the target, so later posts are held
+    nixl_xfer_limits_t limits;
+    limits.maxInflightReqs = 1;
+    assert (A1.setPeerLimits(agent2, limits) == NIXL_SUCCESS);
+
+    // The first one in progress expires while the user only polls the held
+    // one, which then starts in its place
+    testMemPolls = 1000000;
+    nixlXferReqH* first = make_req(A1, src, dst, 0, 2000);
+    nixlXferReqH* held  = make_req(A1, src, dst, 1, 0);
+    assert (A1.postXferReq(first) == NIXL_IN_PROG);
+    assert (A1.postXferReq(held) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+    sleep_us(3000);
+    assert (A1.getXferStatus(held) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+    assert (A1.getXferStatus(first) == NIXL_ERR_TIMEOUT);
+
+    // A held post expires without being started, while the user only polls
+    // the one in progress
+    nixlXferReqH* expiring = make_req(A1, src, dst, 2, 2000);
+    assert (A1.postXferReq(expiring) == NIXL_IN_PROG);
+    sleep_us(3000);
+    assert (A1.getXferStatus(held) == NIXL_IN_PROG);
+    assert (testMemLive == 1);
+    assert (A1.cancelXferReq(held) == NIXL_SUCCESS);
+    assert (A1.getXferStatus(expiring) == NIXL_ERR_TIMEOUT);
+    assert (testMemLive == 0);
+    testMemPolls = 1;
+
+    for (nixlXferReqH* req : {first, held, expiring})
+        assert (A1.releaseXferReq(req) == NIXL_SUCCESS);
+    assert (A1.setPeerLimits(agent2, nixl_xfer_limits_t()) == NIXL_SUCCESS);
+}
+
+int main()
+{
+    registerTestMemBackends();
+
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(agent1, cfg), A2(agent2, cfg);
+    std::vector<char> src(buf_len), dst(buf_len);
+    init_agent(A1, src);
+    init_agent(A2, dst);
+    load_md(A1, A2);
+
+    test_polled(A1, src, dst);
+    test_unpolled(A1, src, dst);
+
+    std::cout << "Test done\n";
+    return 0;
+}
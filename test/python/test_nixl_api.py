@@ -13,13 +13,16 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import ctypes
+import json
+import time
 import uuid
 
 import pytest
 
 import nixl._bindings as bindings
 import nixl._utils as utils
-from nixl._api import nixl_agent
+from nixl._api import nixl_agent, nixl_agent_config
 
 # NIXL pytest fixtures
 
@@ -34,6 +37,43 @@ def two_ucx_agents():
     return (nixl_agent(str(uuid.uuid4())), nixl_agent(str(uuid.uuid4())))
 
 
+# Agents with the given config and a registered DRAM buffer each, the first
+# one having loaded the metadata of the second
+def make_agent_pair(conf, size, target_conf=None):
+    agents = (
+        nixl_agent(str(uuid.uuid4()), conf),
+        nixl_agent(str(uuid.uuid4()), target_conf or conf),
+    )
+    addrs = []
+    for agent in agents:
+        addr = utils.malloc_passthru(size)
+        ctypes.memset(addr, 0, size)
+        reg_descs = agent.get_reg_descs([(addr, size, 0, "test")], "DRAM")
+        assert agent.register_memory(reg_descs) is not None
+        addrs.append(addr)
+    agents[0].add_remote_agent(agents[1].get_agent_metadata())
+    return agents, addrs
+
+
+def wait_xfer(agent, handle):
+    state = agent.check_xfer_state(handle)
+    while state == "PROC":
+        state = agent.check_xfer_state(handle)
+    return state
+
+
+def notified_write(agents, addrs, size):
+    agent1, agent2 = agents
+    local = agent1.get_xfer_descs([(addrs[0], size, 0)], "DRAM")
+    remote = agent2.get_xfer_descs([(addrs[1], size, 0)], "DRAM")
+    handle = agent1.initialize_xfer("WRITE", local, remote, agent2.name, b"done")
+    assert agent1.transfer(handle) != "ERR"
+    assert wait_xfer(agent1, handle) == "DONE"
+    while not agent2.check_remote_xfer_done(agent1.name, b"done"):
+        pass
+    agent1.release_xfer_handle(handle)
+
+
 def test_invalid_backend_name(one_ucx_agent):
     # "UVX" is a typo for "UCX"
     with pytest.raises(bindings.nixlNotFoundError):
@@ -53,6 +93,185 @@ def test_metadata_pass(two_ucx_agents):
     assert passed_name == agent1.name.encode()
 
 
+def test_coalesce_xfers():
+    conf = nixl_agent_config(
+        False, coalesce_max_reqs=4, coalesce_max_bytes=1024, coalesce_window_us=100000
+    )
+    assert conf.coalesce_max_reqs == 4
+    assert conf.coalesce_max_bytes == 1024
+    assert conf.coalesce_window_us == 100000
+
+    size = 4096
+    (agent1, agent2), (addr1, addr2) = make_agent_pair(conf, size)
+    ctypes.memset(addr1, 0xBA, size)
+
+    # Small writes coalesced in a batch of 4, notified in order of post
+    handles = []
+    for i in range(4):
+        local = agent1.get_xfer_descs([(addr1 + i * 1024, 1024, 0)], "DRAM")
+        remote = agent2.get_xfer_descs([(addr2 + i * 1024, 1024, 0)], "DRAM")
+        handles.append(
+            agent1.initialize_xfer("WRITE", local, remote, agent2.name, b"xfer%d" % i)
+        )
+    for handle in handles:
+        assert agent1.transfer(handle) != "ERR"
+    for handle in handles:
+        assert wait_xfer(agent1, handle) == "DONE"
+    assert ctypes.string_at(addr1, size) == ctypes.string_at(addr2, size)
+
+    notifs = []
+    while len(notifs) < 4:
+        notifs += agent2.get_new_notifs().get(agent1.name, [])
+    assert notifs == [b"xfer0", b"xfer1", b"xfer2", b"xfer3"]
+
+    for handle in handles:
+        agent1.release_xfer_handle(handle)
+
+
+def test_cancel_xfer():
+    size = 16 * 1024 * 1024
+    (agent1, agent2), (addr1, addr2) = make_agent_pair(nixl_agent_config(False), size)
+
+    local = agent1.get_xfer_descs([(addr1, size, 0)], "DRAM")
+    remote = agent2.get_xfer_descs([(addr2, size, 0)], "DRAM")
+    handle = agent1.initialize_xfer("WRITE", local, remote, agent2.name)
+    assert agent1.transfer(handle) != "ERR"
+
+    # Either it completed before the cancel, or it is no longer posted
+    agent1.cancel_xfer(handle)
+    try:
+        assert agent1.check_xfer_state(handle) == "DONE"
+    except bindings.nixlNotPostedError:
+        pass
+
+    # Canceling again, or a finished transfer, has no effect
+    agent1.cancel_xfer(handle)
+    agent1.release_xfer_handle(handle)
+
+
+def test_xfer_timeout():
+    size = 16 * 1024 * 1024
+    (agent1, agent2), (addr1, addr2) = make_agent_pair(nixl_agent_config(False), size)
+    ctypes.memset(addr1, 0xBA, size)
+
+    local = agent1.get_xfer_descs([(addr1, size, 0)], "DRAM")
+    remote = agent2.get_xfer_descs([(addr2, size, 0)], "DRAM")
+
+    # A deadline far away does not affect the transfer
+    handle = agent1.agent.createXferReq(
+        bindings.NIXL_WRITE, local, remote, agent2.name, timeout_us=10000000
+    )
+    assert agent1.transfer(handle) != "ERR"
+    assert wait_xfer(agent1, handle) == "DONE"
+    assert ctypes.string_at(addr1, size) == ctypes.string_at(addr2, size)
+    agent1.release_xfer_handle(handle)
+
+    # An expired one cancels the transfer when polled, unless it already completed
+    handle = agent1.agent.createXferReq(
+        bindings.NIXL_WRITE, local, remote, agent2.name, timeout_us=1
+    )
+    assert agent1.transfer(handle) != "ERR"
+    time.sleep(0.001)
+    try:
+        assert wait_xfer(agent1, handle) == "DONE"
+    except bindings.nixlTimeoutError:
+        # The request can't be reposted, only released
+        with pytest.raises(bindings.nixlNotAllowedError):
+            agent1.agent.postXferReq(handle)
+    agent1.release_xfer_handle(handle)
+
+
+def test_get_stats():
+    conf = nixl_agent_config(False, enable_telemetry=True)
+    assert conf.enable_telemetry
+
+    size = 4096
+    agents, addrs = make_agent_pair(conf, size)
+    agent1, agent2 = agents
+    notified_write(agents, addrs, size)
+
+    stats = agent1.get_stats()
+    peer = stats["peers"][agent2.name]["WRITE"]
+    assert peer["post_count"] == 1
+    assert peer["xfer_count"] == 1
+    assert peer["error_count"] == 0
+    assert peer["total_bytes"] == size
+    assert peer["max_ns"] > 0
+    assert sum(peer["latency_buckets"]) == 1
+    assert stats["peers"][agent2.name]["READ"]["xfer_count"] == 0
+
+    assert stats["backends"]["UCX"]["WRITE"]["total_bytes"] == size
+    assert stats["backend_counters"]["UCX"]["registered_bytes"] == size
+    assert stats["notifs_sent"] == 1
+    assert agent2.get_stats()["notifs_received"] == 1
+
+    # Telemetry is off by default
+    agent3 = nixl_agent(str(uuid.uuid4()), nixl_agent_config(False))
+    with pytest.raises(bindings.nixlNotSupportedError):
+        agent3.get_stats()
+
+
+def test_export_stats(tmp_path):
+    path = tmp_path / "stats.json"
+    conf = nixl_agent_config(
+        False,
+        stats_export_path=str(path),
+        stats_export_period_us=1000,
+        stats_export_json=True,
+    )
+
+    size = 4096
+    agents, addrs = make_agent_pair(conf, size, nixl_agent_config(False))
+    agent1, agent2 = agents
+    notified_write(agents, addrs, size)
+
+    labels = 'agent="%s",peer="%s",op="WRITE"' % (agent1.name, agent2.name)
+    text = agent1.export_stats()
+    assert "nixl_peer_xfer_completed_total{%s} 1\n" % labels in text
+    assert "nixl_peer_xfer_bytes_total{%s} %d\n" % (labels, size) in text
+    assert 'nixl_notifs_sent_total{agent="%s"} 1\n' % agent1.name in text
+
+    stats = json.loads(agent1.export_stats(json=True))
+    assert stats["agent"] == agent1.name
+    assert stats["peers"][agent2.name]["WRITE"]["xfer_count"] == 1
+    assert stats["notifs_sent"] == 1
+
+    # Exported periodically, wait for a write after the transfer
+    for i in range(5000):
+        if path.exists() and json.loads(path.read_text())["notifs_sent"] == 1:
+            break
+        time.sleep(0.001)
+    stats = json.loads(path.read_text())
+    assert stats["agent"] == agent1.name
+    assert stats["notifs_sent"] == 1
+
+
+def test_dump_trace(tmp_path):
+    conf = nixl_agent_config(False, enable_tracing=True)
+    assert conf.enable_tracing
+
+    size = 4096
+    agents, addrs = make_agent_pair(conf, size)
+    agent1 = agents[0]
+    notified_write(agents, addrs, size)
+
+    path = tmp_path / "trace.json"
+    agent1.dump_trace(str(path))
+
+    trace = json.loads(path.read_text())
+    assert trace["displayTimeUnit"] == "ns"
+    events = trace["traceEvents"]
+    names = {event["name"] for event in events}
+    for name in ["registerMem", "createXferReq", "backend.postXfer"]:
+        assert name in names
+    for event in events:
+        assert event["ph"] == "X"
+        assert event["dur"] >= 0
+
+    with pytest.raises(bindings.nixlBackendError):
+        agent1.dump_trace(str(tmp_path / "missing" / "trace.json"))
+
+
 # monkeypatch limits scope of env change to this test
 # skipping because plugin manager is only created one time statically
 # (changing env here does nothing)
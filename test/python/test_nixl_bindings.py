@@ -15,6 +15,8 @@
 
 import pickle
 
+import pytest
+
 import nixl._bindings as nixl
 import nixl._utils as nixl_utils
 
@@ -156,3 +158,134 @@ def test_agent():
 
     nixl_utils.free_passthru(addr1)
     nixl_utils.free_passthru(addr2)
+
+
+def test_reg_cache():
+    config = nixl.nixlAgentConfig(False)
+    config.regCacheSize = 1 << 20
+    assert config.regCacheSize == 1 << 20
+
+    agent = nixl.nixlAgent("RegCacheAgent", config)
+    ucx = agent.createBackend("UCX", {})
+
+    size = 4096
+    addr = nixl_utils.malloc_passthru(size)
+
+    reg_list = nixl.nixlRegDList(nixl.DRAM_SEG, False)
+    reg_list.addDesc((addr, size, 0, "cached"))
+    xfer_list = nixl.nixlXferDList(nixl.DRAM_SEG, False)
+    xfer_list.addDesc((addr, size, 0))
+
+    # Deregistration is lazy, the second registration reuses the first one
+    for i in range(2):
+        ret = agent.registerMem(reg_list, [ucx])
+        assert ret == nixl.NIXL_SUCCESS
+        ret = agent.deregisterMem(reg_list, [ucx])
+        assert ret == nixl.NIXL_SUCCESS
+
+    # Memory still registered can't be released
+    ret = agent.registerMem(reg_list, [ucx])
+    assert ret == nixl.NIXL_SUCCESS
+    with pytest.raises(nixl.nixlNotAllowedError):
+        agent.releasedMem(xfer_list)
+
+    ret = agent.deregisterMem(reg_list, [ucx])
+    assert ret == nixl.NIXL_SUCCESS
+    assert agent.releasedMem(xfer_list) == nixl.NIXL_SUCCESS
+
+    nixl_utils.free_passthru(addr)
+
+
+def test_coalesce_regs():
+    config = nixl.nixlAgentConfig(False)
+    config.coalesceRegs = True
+    assert config.coalesceRegs
+
+    name1 = "CoalesceAgent1"
+    name2 = "CoalesceAgent2"
+    agent1 = nixl.nixlAgent(name1, config)
+    agent2 = nixl.nixlAgent(name2, nixl.nixlAgentConfig(False))
+
+    ucx1 = agent1.createBackend("UCX", {})
+    ucx2 = agent2.createBackend("UCX", {})
+
+    size = 4096
+    addr1 = nixl_utils.malloc_passthru(size)
+    addr2 = nixl_utils.malloc_passthru(size)
+
+    nixl_utils.ba_buf(addr1, size)
+
+    # Overlapping and adjacent halves of the same buffer become one region
+    reg_lists = []
+    for offset, length in [(0, size // 2), (size // 4, size // 2), (size // 2, size // 2)]:
+        reg_list = nixl.nixlRegDList(nixl.DRAM_SEG, False)
+        reg_list.addDesc((addr1 + offset, length, 0, "part"))
+        ret = agent1.registerMem(reg_list, [ucx1])
+        assert ret == nixl.NIXL_SUCCESS
+        reg_lists.append(reg_list)
+
+    reg_list2 = nixl.nixlRegDList(nixl.DRAM_SEG, False)
+    reg_list2.addDesc((addr2, size, 0, "whole"))
+    ret = agent2.registerMem(reg_list2, [ucx2])
+    assert ret == nixl.NIXL_SUCCESS
+
+    ret_name = agent2.loadRemoteMD(agent1.getLocalMD())
+    assert ret_name.decode(encoding="UTF-8") == name1
+
+    # A single descriptor across the registrations is valid remotely
+    local_list = nixl.nixlXferDList(nixl.DRAM_SEG, False)
+    local_list.addDesc((addr2, size, 0))
+    remote_list = nixl.nixlXferDList(nixl.DRAM_SEG, False)
+    remote_list.addDesc((addr1, size, 0))
+
+    handle = agent2.createXferReq(nixl.NIXL_READ, local_list, remote_list, name1)
+    assert handle != 0
+
+    status = agent2.postXferReq(handle)
+    while status == nixl.NIXL_IN_PROG:
+        status = agent2.getXferStatus(handle)
+    assert status == nixl.NIXL_SUCCESS
+
+    nixl_utils.verify_transfer(addr1, addr2, size)
+    agent2.releaseXferReq(handle)
+    agent2.invalidateRemoteMD(name1)
+
+    for reg_list in reg_lists:
+        ret = agent1.deregisterMem(reg_list, [ucx1])
+        assert ret == nixl.NIXL_SUCCESS
+
+    ret = agent2.deregisterMem(reg_list2, [ucx2])
+    assert ret == nixl.NIXL_SUCCESS
+
+    nixl_utils.free_passthru(addr1)
+    nixl_utils.free_passthru(addr2)
+
+
+def test_alloc_mem():
+    config = nixl.nixlAgentConfig(False)
+    config.allocArenaSize = 4 << 20
+    assert config.allocArenaSize == 4 << 20
+
+    agent = nixl.nixlAgent("AllocAgent", config)
+    ucx = agent.createBackend("UCX", {})
+
+    size = 5000
+    bufs = [agent.allocMem(size, nixl.DRAM_SEG, [ucx]) for i in range(2)]
+
+    for addr, length, dev_id in bufs:
+        assert addr != 0
+        assert length >= size
+        assert dev_id == 0
+    assert bufs[0][0] != bufs[1][0]
+
+    # Buffers are covered by their arena's registration
+    assert len(agent.getLocalMD()) > 0
+
+    with pytest.raises(nixl.nixlNotSupportedError):
+        agent.allocMem(size, nixl.VRAM_SEG, [ucx])
+
+    for addr, length, dev_id in bufs:
+        assert agent.freeMem(addr, length, dev_id) == nixl.NIXL_SUCCESS
+
+    with pytest.raises(nixl.nixlNotFoundError):
+        agent.freeMem(bufs[0][0], bufs[0][1], bufs[0][2])